@@ -0,0 +1,147 @@
+///
+/// @file		Bench.cpp
+/// @author		Junpyo Hong (jp7.hong@gmail.com)
+/// @date		Oct. 18, 2026
+/// @version	1.0
+/// @brief		micro-benchmarks of the move generator building blocks
+/// @remark		Tab size: 4
+///
+
+#include <iostream>		// std::cout
+#include <iomanip>		// std::setw, std::setprecision
+#include <chrono>		// std::chrono::steady_clock
+#include <vector>		// std::vector
+
+#include "Bench.h"
+#include "Bitboard.h"
+#include "Perft.h"
+#include "SmpSearch.h"
+
+namespace
+{
+	/// the number of random occupancies per square
+	const int BENCH_OCCUPANCIES = 1024;
+
+	/// the number of passes over all (square, occupancy) pairs
+	const int BENCH_PASSES = 20;
+
+	/// fixed positions for the search benchmarks (moves from the initial position)
+	const char *s_arrBenchMoves[] =
+	{
+		"",
+		"E2,E3 D7,D6 F1,B5 C7,C6",
+		"A2,A3 H7,H6 A3,A4 H6,H5 A1,A3 H8,H6",
+		"D2,D3 E7,E6 C1,F4 F8,B4 E1,D1 B4,C3",
+	};
+	const int BENCH_POSITIONS = int(sizeof(s_arrBenchMoves) / sizeof(s_arrBenchMoves[0]));
+
+	/// @brief		time a sliding attack function over all squares and occupancies
+	/// @param		vOcc [in] random occupancies
+	/// @param		pfnAttacks [in] attack function to measure
+	/// @param		bbSink [out] xor of every result (keeps the calls alive)
+	/// @return		nanoseconds per call
+	template<typename F>
+	double
+	TimeAttacks(const std::vector<Bitboard>& vOcc, F pfnAttacks, Bitboard& bbSink)
+	{
+		std::chrono::steady_clock::time_point tBegin = std::chrono::steady_clock::now();
+
+		for (int pass = 0; pass < BENCH_PASSES; pass++)
+			for (int sq = 0; sq < SQUARE_NB; sq++)
+				for (size_t i = 0; i < vOcc.size(); i++)
+					bbSink ^= pfnAttacks(sq, vOcc[i]);
+
+		std::chrono::duration<double, std::nano> dt = std::chrono::steady_clock::now() - tBegin;
+		return dt.count() / (double(BENCH_PASSES) * SQUARE_NB * vOcc.size());
+	}
+}
+
+/// @brief		compare the ray walkers with the magic (or PEXT) table lookups
+/// @param		N/A
+/// @return		void
+void
+BenchSliders()
+{
+	// random occupancies with about a quarter of the squares filled
+	std::vector<Bitboard> vOcc;
+	Bitboard s = 0x2545F4914F6CDD1DULL;
+	for (int i = 0; i < BENCH_OCCUPANCIES; i++)
+	{
+		Bitboard bb = ~Bitboard(0);
+		for (int j = 0; j < 2; j++)
+		{
+			s ^= s << 13; s ^= s >> 7; s ^= s << 17;
+			bb &= s;
+		}
+		vOcc.push_back(bb);
+	}
+
+	// both implementations must give the same checksum
+	Bitboard arrSink[4] = { 0, 0, 0, 0 };
+	double dRookSlow = TimeAttacks(vOcc, GetRookAttacksSlow, arrSink[0]);
+	double dRookFast = TimeAttacks(vOcc, GetRookAttacks, arrSink[1]);
+	double dBishSlow = TimeAttacks(vOcc, GetBishAttacksSlow, arrSink[2]);
+	double dBishFast = TimeAttacks(vOcc, GetBishAttacks, arrSink[3]);
+
+	const char *szFast = g_bUsePext ? "pext" : "magic";
+
+	std::cout << std::fixed << std::setprecision(2);
+	std::cout << "rook   ray walk: " << std::setw(7) << dRookSlow << " ns/op" << std::endl;
+	std::cout << "rook   " << std::setw(8) << std::left << (std::string(szFast) + ":") \
+		<< std::right << std::setw(7) << dRookFast << " ns/op  (x" << dRookSlow / dRookFast << ")" << std::endl;
+	std::cout << "bishop ray walk: " << std::setw(7) << dBishSlow << " ns/op" << std::endl;
+	std::cout << "bishop " << std::setw(8) << std::left << (std::string(szFast) + ":") \
+		<< std::right << std::setw(7) << dBishFast << " ns/op  (x" << dBishSlow / dBishFast << ")" << std::endl;
+	std::cout << "checksum: " << ((arrSink[0] == arrSink[1] && arrSink[2] == arrSink[3]) ? \
+		"match" : "MISMATCH") << std::endl;
+}
+
+/// @brief		time-to-depth of lazy SMP from 1 to nMaxThreads threads
+/// @param		nMaxThreads [in] the largest number of threads (doubled from 1)
+/// @param		nDepth [in] fixed search depth
+/// @param		nHashMB [in] transposition table size (cleared before every search)
+/// @return		void
+void
+BenchSmp(const int nMaxThreads, const int nDepth, const size_t nHashMB)
+{
+	CTransTable tt;
+	tt.Resize(nHashMB);
+
+	SSearchLimits limits;
+	limits.nDepth = nDepth;
+
+	double dBaseSec = 0;
+
+	std::cout << "threads    time(ms)  speedup        nodes" << std::endl;
+	for (int nThreads = 1; ; nThreads *= 2)
+	{
+		if (nThreads > nMaxThreads)
+			nThreads = nMaxThreads;
+
+		CSmpSearch search(&tt, nThreads);
+		double dSec = 0;
+		uint64_t nNodes = 0;
+
+		for (int i = 0; i < BENCH_POSITIONS; i++)
+		{
+			CPosition pos;
+			pos.SetStartPos();
+			ApplyMoveText(pos, s_arrBenchMoves[i]);
+
+			tt.Clear();
+			SSearchResult result = search.Go(pos, limits);
+			dSec += result.dSeconds;
+			nNodes += result.nNodes;
+		}
+
+		if (nThreads == 1)
+			dBaseSec = dSec;
+
+		std::cout << std::fixed << std::setprecision(2) \
+			<< std::setw(7) << nThreads << std::setw(12) << dSec * 1000 \
+			<< std::setw(9) << dBaseSec / dSec << std::setw(13) << nNodes << std::endl;
+
+		if (nThreads == nMaxThreads)
+			break;
+	}
+}
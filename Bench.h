@@ -0,0 +1,16 @@
+///
+/// @file		Bench.h
+/// @author		Junpyo Hong (jp7.hong@gmail.com)
+/// @date		Oct. 18, 2026
+/// @version	1.0
+/// @brief		micro-benchmarks of the move generator building blocks
+/// @remark		Tab size: 4
+///
+
+#ifndef _BENCH_H_
+#define _BENCH_H_
+
+void BenchSliders();
+void BenchSmp(const int nMaxThreads, const int nDepth, const size_t nHashMB);
+
+#endif // _BENCH_H_
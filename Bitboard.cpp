@@ -0,0 +1,281 @@
+///
+/// @file		Bitboard.cpp
+/// @author		Junpyo Hong (jp7.hong@gmail.com)
+/// @date		Oct. 18, 2026
+/// @version	1.0
+/// @brief		64-bit bitboard type, square helpers and attack tables
+/// @remark		Tab size: 4
+///
+
+#include <cstring>		// memset
+#include <cassert>		// assert
+
+#include "Bitboard.h"
+#include "CpuFeatures.h"
+
+#if !defined(__BMI2__) && defined(CHESS_X86)
+#include <immintrin.h>	// _pext_u64
+#endif
+
+/// king attack table (indexed by square)
+Bitboard g_bbKingAttacks[SQUARE_NB];
+
+/// pawn diagonal attack table (indexed by side and square)
+Bitboard g_bbPawnAttacks[2][SQUARE_NB];
+
+/// squares strictly between two aligned squares (indexed by both squares)
+Bitboard g_bbBetween[SQUARE_NB][SQUARE_NB];
+
+/// line through two aligned squares, edge to edge (indexed by both squares)
+Bitboard g_bbLine[SQUARE_NB][SQUARE_NB];
+
+/// use PEXT instead of magic multiplication
+bool g_bUsePext = false;
+
+/// rook and bishop magic entries (indexed by square)
+SMagic g_rookMagics[SQUARE_NB];
+SMagic g_bishMagics[SQUARE_NB];
+
+/// @brief		PEXT index for builds that don't assume BMI2
+/// @param		bbOccupied [in] all pieces on the board
+/// @param		bbMask [in] relevant occupancy mask
+/// @return		bits of bbOccupied selected by bbMask, packed to the low end
+/// @remark		only called when g_bUsePext is set, i.e. the CPU supports BMI2
+CHESS_TARGET("bmi2") unsigned
+PextIndex(const Bitboard bbOccupied, const Bitboard bbMask)
+{
+#if defined(CHESS_X86)
+	return unsigned(_pext_u64(bbOccupied, bbMask));
+#else
+	(void)bbOccupied;
+	(void)bbMask;
+	assert(false);
+	return 0;
+#endif
+}
+
+namespace
+{
+	/// ray directions: (0)..(3) go towards higher square indices, (4)..(7) towards lower
+	enum ERayDir { RAY_N = 0, RAY_E, RAY_NE, RAY_NW, RAY_S, RAY_W, RAY_SW, RAY_SE, RAY_NB };
+
+	/// (x, y) step of each ray direction
+	constexpr int s_arrRayDelta[RAY_NB][2] =
+	{
+		{  0, +1 }, { +1,  0 }, { +1, +1 }, { -1, +1 },
+		{  0, -1 }, { -1,  0 }, { -1, -1 }, { +1, -1 },
+	};
+
+	/// squares from a square to the edge of the board (not including the square itself)
+	Bitboard s_bbRays[RAY_NB][SQUARE_NB];
+
+	/// attack tables shared by all squares (sum of 2^bits of each relevant mask)
+	Bitboard s_bbRookTable[0x19000];
+	Bitboard s_bbBishTable[0x1480];
+
+	/// @brief		attacks along one ray, stopped at (and including) the first blocker
+	inline Bitboard
+	GetRayAttacks(const int dir, const int sq, const Bitboard bbOccupied)
+	{
+		Bitboard bbRay = s_bbRays[dir][sq];
+		Bitboard bbBlockers = bbRay & bbOccupied;
+
+		if (bbBlockers)
+		{
+			// the nearest blocker is the lowest bit for upward rays, highest for downward
+			int nBlocker = (dir < RAY_S) ? Lsb(bbBlockers) : Msb(bbBlockers);
+			bbRay ^= s_bbRays[dir][nBlocker];
+		}
+
+		return bbRay;
+	}
+
+	/// @brief		xorshift64* generator used to search magic multipliers
+	inline Bitboard
+	NextRandom(Bitboard& s)
+	{
+		s ^= s >> 12;
+		s ^= s << 25;
+		s ^= s >> 27;
+		return s * 2685821657736338717ULL;
+	}
+
+	/// @brief		build magic (or PEXT) attack tables of one sliding piece type
+	/// @param		arrMagics [out] magic entries of all squares
+	/// @param		pTable [out] attack table shared by all squares
+	/// @param		pfnSlow [in] ray walker which gives the reference attacks
+	void
+	InitMagics(SMagic arrMagics[], Bitboard *pTable, \
+		Bitboard (*pfnSlow)(const int, const Bitboard))
+	{
+		Bitboard arrOccupancy[4096];
+		Bitboard arrReference[4096];
+		int arrEpoch[4096];
+		int nEpoch = 0;
+		Bitboard nSeed = 0x9E3779B97F4A7C15ULL;		// fixed seed for the same tables every run
+
+		memset(arrEpoch, 0, sizeof(arrEpoch));
+
+		for (int sq = 0; sq < SQUARE_NB; sq++)
+		{
+			SMagic& m = arrMagics[sq];
+
+			// the edge squares never block a ray, unless the piece stands on that edge
+			Bitboard bbEdges = ((BB_RANK_1 | BB_RANK_8) & ~(BB_RANK_1 << (8 * SQ_Y(sq)))) \
+				| ((BB_FILE_A | BB_FILE_H) & ~(BB_FILE_A << SQ_X(sq)));
+
+			m.bbMask = pfnSlow(sq, 0) & ~bbEdges;
+			m.nShift = 64 - PopCount(m.bbMask);
+			m.pAttacks = pTable;
+
+			// enumerate every subset of the mask (Carry-Rippler)
+			int nSize = 0;
+			Bitboard bbOcc = 0;
+			do
+			{
+				arrOccupancy[nSize] = bbOcc;
+				arrReference[nSize] = pfnSlow(sq, bbOcc);
+				nSize++;
+				bbOcc = (bbOcc - m.bbMask) & m.bbMask;
+			} while (bbOcc);
+
+			if (g_bUsePext)
+			{
+				for (int i = 0; i < nSize; i++)
+					m.pAttacks[m.Index(arrOccupancy[i])] = arrReference[i];
+			}
+			else
+			{
+				// try sparse random multipliers until every subset maps without a collision
+				int i = 0;
+				while (i < nSize)
+				{
+					m.bbMagic = NextRandom(nSeed) & NextRandom(nSeed) & NextRandom(nSeed);
+					if (PopCount((m.bbMask * m.bbMagic) >> 56) < 6)
+						continue;
+
+					for (++nEpoch, i = 0; i < nSize; i++)
+					{
+						unsigned idx = m.Index(arrOccupancy[i]);
+
+						if (arrEpoch[idx] < nEpoch)
+						{
+							arrEpoch[idx] = nEpoch;
+							m.pAttacks[idx] = arrReference[i];
+						}
+						else if (m.pAttacks[idx] != arrReference[i])
+						{
+							break;
+						}
+					}
+				}
+			}
+
+			pTable += nSize;
+		}
+	}
+
+	/// @brief		fill every attack table once at program start-up
+	struct SBitboardInit
+	{
+		SBitboardInit()
+		{
+			// the king moves exactly one square in any direction
+			static constexpr int arrKingDelta[8][2] =
+			{
+				{  0, +1 }, { +1, +1 }, { +1,  0 }, { +1, -1 },
+				{  0, -1 }, { -1, -1 }, { -1,  0 }, { -1, +1 },
+			};
+
+			for (int sq = 0; sq < SQUARE_NB; sq++)
+			{
+				int x = SQ_X(sq);
+				int y = SQ_Y(sq);
+
+				g_bbKingAttacks[sq] = 0;
+				for (int i = 0; i < 8; i++)
+				{
+					int nx = x + arrKingDelta[i][0];
+					int ny = y + arrKingDelta[i][1];
+					if (nx >= 0 && nx < BOARD_LEN && ny >= 0 && ny < BOARD_LEN)
+						g_bbKingAttacks[sq] |= SqBB(SQ(nx, ny));
+				}
+
+				// white pawns capture towards row 8, black pawns towards row 1
+				g_bbPawnAttacks[0][sq] = 0;
+				g_bbPawnAttacks[1][sq] = 0;
+				for (int dx = -1; dx <= 1; dx += 2)
+				{
+					int nx = x + dx;
+					if (nx < 0 || nx >= BOARD_LEN)
+						continue;
+					if (y + 1 < BOARD_LEN)
+						g_bbPawnAttacks[0][sq] |= SqBB(SQ(nx, y + 1));
+					if (y - 1 >= 0)
+						g_bbPawnAttacks[1][sq] |= SqBB(SQ(nx, y - 1));
+				}
+
+				for (int dir = 0; dir < RAY_NB; dir++)
+				{
+					s_bbRays[dir][sq] = 0;
+					int nx = x + s_arrRayDelta[dir][0];
+					int ny = y + s_arrRayDelta[dir][1];
+					while (nx >= 0 && nx < BOARD_LEN && ny >= 0 && ny < BOARD_LEN)
+					{
+						s_bbRays[dir][sq] |= SqBB(SQ(nx, ny));
+						nx += s_arrRayDelta[dir][0];
+						ny += s_arrRayDelta[dir][1];
+					}
+				}
+			}
+
+			// sliding attacks for any occupancy become a single table lookup
+			g_bUsePext = CpuHasBmi2();
+			InitMagics(g_rookMagics, s_bbRookTable, GetRookAttacksSlow);
+			InitMagics(g_bishMagics, s_bbBishTable, GetBishAttacksSlow);
+
+			// a line is where the empty-board rays of both squares cross
+			for (int sq1 = 0; sq1 < SQUARE_NB; sq1++)
+			{
+				for (int sq2 = 0; sq2 < SQUARE_NB; sq2++)
+				{
+					g_bbBetween[sq1][sq2] = 0;
+					g_bbLine[sq1][sq2] = 0;
+
+					Bitboard (*pfnSlow)(const int, const Bitboard) = 0;
+					if (GetRookAttacksSlow(sq1, 0) & SqBB(sq2))
+						pfnSlow = GetRookAttacksSlow;
+					else if (GetBishAttacksSlow(sq1, 0) & SqBB(sq2))
+						pfnSlow = GetBishAttacksSlow;
+					else
+						continue;
+
+					g_bbBetween[sq1][sq2] = pfnSlow(sq1, SqBB(sq2)) & pfnSlow(sq2, SqBB(sq1));
+					g_bbLine[sq1][sq2] = (pfnSlow(sq1, 0) & pfnSlow(sq2, 0)) | SqBB(sq1) | SqBB(sq2);
+				}
+			}
+		}
+	} s_bitboardInit;
+}
+
+/// @brief		squares attacked by a rook on sq, by walking the four rays
+/// @param		sq [in] square of the rook
+/// @param		bbOccupied [in] all pieces on the board
+/// @return		attacked squares, including the first blocker of each direction
+Bitboard
+GetRookAttacksSlow(const int sq, const Bitboard bbOccupied)
+{
+	return GetRayAttacks(RAY_N, sq, bbOccupied) | GetRayAttacks(RAY_E, sq, bbOccupied)
+		| GetRayAttacks(RAY_S, sq, bbOccupied) | GetRayAttacks(RAY_W, sq, bbOccupied);
+}
+
+/// @brief		squares attacked by a bishop on sq, by walking the four rays
+/// @param		sq [in] square of the bishop
+/// @param		bbOccupied [in] all pieces on the board
+/// @return		attacked squares, including the first blocker of each direction
+Bitboard
+GetBishAttacksSlow(const int sq, const Bitboard bbOccupied)
+{
+	return GetRayAttacks(RAY_NE, sq, bbOccupied) | GetRayAttacks(RAY_NW, sq, bbOccupied)
+		| GetRayAttacks(RAY_SW, sq, bbOccupied) | GetRayAttacks(RAY_SE, sq, bbOccupied);
+}
@@ -0,0 +1,182 @@
+///
+/// @file		Bitboard.h
+/// @author		Junpyo Hong (jp7.hong@gmail.com)
+/// @date		Oct. 18, 2026
+/// @version	1.0
+/// @brief		64-bit bitboard type, square helpers and attack tables
+/// @remark		Tab size: 4
+///
+
+#ifndef _BITBOARD_H_
+#define _BITBOARD_H_
+
+#include <cstdint>		// uint64_t
+
+#if defined(_MSC_VER)
+#include <intrin.h>		// _BitScanForward64, _BitScanReverse64, __popcnt64
+#endif
+
+#if defined(__BMI2__)
+#include <immintrin.h>	// _pext_u64
+#endif
+
+/// length of column and row
+#ifndef BOARD_LEN
+#define BOARD_LEN	(8)
+#endif
+
+/// the number of squares on the board
+#define SQUARE_NB	(BOARD_LEN * BOARD_LEN)
+
+/// square index of column x ['0'..'7'] and row y ['0'..'7'] (A1 = 0, H8 = 63)
+#define SQ(x,y)		((y) * BOARD_LEN + (x))
+
+/// column index of a square
+#define SQ_X(sq)	((sq) & (BOARD_LEN - 1))
+
+/// row index of a square
+#define SQ_Y(sq)	((sq) >> 3)
+
+/// one bit per square, bit 0 is A1 and bit 63 is H8
+typedef uint64_t Bitboard;
+
+/// rank and file masks
+const Bitboard BB_FILE_A = 0x0101010101010101ULL;
+const Bitboard BB_FILE_H = BB_FILE_A << 7;
+const Bitboard BB_RANK_1 = 0xFFULL;
+const Bitboard BB_RANK_8 = BB_RANK_1 << 56;
+
+/// king attack table (indexed by square)
+extern Bitboard g_bbKingAttacks[SQUARE_NB];
+
+/// pawn diagonal attack table (indexed by side and square)
+extern Bitboard g_bbPawnAttacks[2][SQUARE_NB];
+
+/// squares strictly between two squares on a common row, column, or diagonal (0 if not aligned)
+extern Bitboard g_bbBetween[SQUARE_NB][SQUARE_NB];
+
+/// the whole row, column, or diagonal through two squares (0 if not aligned)
+extern Bitboard g_bbLine[SQUARE_NB][SQUARE_NB];
+
+/// use PEXT instead of magic multiplication (set once at start-up when BMI2 is available)
+extern bool g_bUsePext;
+
+/// PEXT index for builds that don't assume BMI2 (dispatched at run time by g_bUsePext)
+unsigned PextIndex(const Bitboard bbOccupied, const Bitboard bbMask);
+
+/// @brief		magic bitboard entry of one square for a sliding piece
+struct SMagic
+{
+	Bitboard bbMask;		///< relevant occupancy (rays without the board edges)
+	Bitboard bbMagic;		///< magic multiplier (unused when g_bUsePext is set)
+	Bitboard *pAttacks;		///< attack table of this square
+	unsigned nShift;		///< 64 - the number of bits of bbMask
+
+	/// @brief		attack table index of an occupancy
+	unsigned Index(const Bitboard bbOccupied) const
+	{
+		if (g_bUsePext)
+		{
+#if defined(__BMI2__)
+			return unsigned(_pext_u64(bbOccupied, bbMask));
+#else
+			return PextIndex(bbOccupied, bbMask);
+#endif
+		}
+
+		return unsigned(((bbOccupied & bbMask) * bbMagic) >> nShift);
+	}
+};
+
+/// rook and bishop magic entries (indexed by square)
+extern SMagic g_rookMagics[SQUARE_NB];
+extern SMagic g_bishMagics[SQUARE_NB];
+
+/// @brief		bitboard which has only one bit of the given square
+inline Bitboard SqBB(const int sq) { return Bitboard(1) << sq; }
+
+/// @brief		the number of set bits
+inline int
+PopCount(Bitboard bb)
+{
+#if defined(_MSC_VER)
+	return int(__popcnt64(bb));
+#else
+	return __builtin_popcountll(bb);
+#endif
+}
+
+/// @brief		index of the least significant set bit (bb must not be 0)
+inline int
+Lsb(Bitboard bb)
+{
+#if defined(_MSC_VER)
+	unsigned long idx;
+	_BitScanForward64(&idx, bb);
+	return int(idx);
+#else
+	return __builtin_ctzll(bb);
+#endif
+}
+
+/// @brief		index of the most significant set bit (bb must not be 0)
+inline int
+Msb(Bitboard bb)
+{
+#if defined(_MSC_VER)
+	unsigned long idx;
+	_BitScanReverse64(&idx, bb);
+	return int(idx);
+#else
+	return 63 ^ __builtin_clzll(bb);
+#endif
+}
+
+/// @brief		return the least significant set bit and clear it from bb
+inline int
+PopLsb(Bitboard& bb)
+{
+	int sq = Lsb(bb);
+	bb &= bb - 1;
+	return sq;
+}
+
+/// @brief		shift all squares one row up (towards row 8)
+inline Bitboard ShiftUp(const Bitboard bb) { return bb << BOARD_LEN; }
+
+/// @brief		shift all squares one row down (towards row 1)
+inline Bitboard ShiftDown(const Bitboard bb) { return bb >> BOARD_LEN; }
+
+/// @brief		squares attacked by a king on sq
+inline Bitboard GetKingAttacks(const int sq) { return g_bbKingAttacks[sq]; }
+
+/// @brief		squares attacked diagonally by a pawn of side on sq
+inline Bitboard GetPawnAttacks(const int side, const int sq) { return g_bbPawnAttacks[side][sq]; }
+
+/// @brief		squares strictly between sq1 and sq2 (0 if they are not aligned)
+inline Bitboard GetBetween(const int sq1, const int sq2) { return g_bbBetween[sq1][sq2]; }
+
+/// @brief		the whole line through sq1 and sq2 (0 if they are not aligned)
+inline Bitboard GetLine(const int sq1, const int sq2) { return g_bbLine[sq1][sq2]; }
+
+/// @brief		squares attacked by a rook on sq (first blocker of each direction included)
+inline Bitboard
+GetRookAttacks(const int sq, const Bitboard bbOccupied)
+{
+	const SMagic& m = g_rookMagics[sq];
+	return m.pAttacks[m.Index(bbOccupied)];
+}
+
+/// @brief		squares attacked by a bishop on sq (first blocker of each direction included)
+inline Bitboard
+GetBishAttacks(const int sq, const Bitboard bbOccupied)
+{
+	const SMagic& m = g_bishMagics[sq];
+	return m.pAttacks[m.Index(bbOccupied)];
+}
+
+/// ray walkers used to build the magic tables (and as a reference for the benchmark)
+Bitboard GetRookAttacksSlow(const int sq, const Bitboard bbOccupied);
+Bitboard GetBishAttacksSlow(const int sq, const Bitboard bbOccupied);
+
+#endif // _BITBOARD_H_
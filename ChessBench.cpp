@@ -0,0 +1,591 @@
+///
+/// @file		ChessBench.cpp
+/// @author		Junpyo Hong (jp7.hong@gmail.com)
+/// @date		Oct. 18, 2026
+/// @version	1.0
+/// @brief		chess_bench: timings of move generation, check detection, decisions, evaluation, SEE, replay, and search
+/// @remark		Tab size: 4
+///
+
+#include <iostream>		// std::cout, std::cerr
+#include <iomanip>		// std::setw, std::setprecision
+#include <chrono>		// std::chrono::steady_clock
+#include <vector>		// std::vector
+#include <algorithm>	// std::sort
+#include <cstring>		// strcmp, strstr, strlen
+#include <cstdlib>		// atoi
+
+#include "ChessBoard.h"
+#include "ChessPieceKing.h"
+#include "ChessPieceRook.h"
+#include "ChessPieceBish.h"
+#include "ChessPiecePawn.h"
+#include "MoveGen.h"
+#include "Eval.h"
+#include "EvalBatch.h"
+#include "Nnue.h"
+#include "Replay.h"
+#include "Search.h"
+#include "See.h"
+#include "Instrument.h"
+
+namespace
+{
+	/// fixed corpus of positions (sampled from random games of this variant, never edit:
+	/// the figures are only comparable between releases on the same corpus)
+	const char *s_arrCorpusFen[] =
+	{
+		"1rb1kbBr/ppppp1p1/5p1p/8/8/P3PP2/1PPP2PP/R1BK3R b",
+		"r1b1kbr1/pppp2p1/4p2p/5p2/8/P1PPP2P/1P3PP1/R1B1KBR1 b",
+		"r1b1k1r1/p1pp4/4p1pp/2b1PpB1/8/P2p2PP/1P3P2/R3KBR1 w",
+		"2b2kr1/r1pp4/p3p1pp/R3Pp2/6P1/3p3P/1b2KP2/2B2B1R b",
+		"5k2/rbppr3/p3p1p1/R3Pp1p/3b2P1/B2K3P/5PB1/6R1 w",
+		"2b1r3/r1pp2k1/p3p1p1/R3Pp2/4B1Pp/B1b4P/K4P2/3R4 b",
+		"2br4/rBp2k2/p3p1p1/R3p3/1B4Pp/8/K4P2/b2R4 w",
+		"1rb5/2p1R2r/p3pkp1/2R1p1P1/1B5p/8/1K3P2/b7 b",
+		"r1bk3r/pp1ppp1p/B1p3p1/8/3b4/1P2P3/PBPP1PPP/R3KR2 b",
+		"r1bkr3/p3pp2/p2p2pp/8/1B1p4/1P1P4/P1P2PPP/R2K1R2 w",
+		"r2k1r2/p3p3/p2p1p2/5bpp/3p4/PPPP3P/5PP1/R2KBR2 b",
+		"r2r4/p3p3/p2pkp2/6pp/3P2b1/PPKP4/5PP1/2R1BR2 w",
+		"r7/pr2p3/3p1p2/p2k2pp/1P1P2b1/P1KP4/3B1PP1/1R3R2 b",
+		"8/p2rp1r1/3p1p2/pP2k1B1/3P3p/P2P3b/2K2PP1/4RR2 w",
+		"8/4p3/p2p1B2/pr4r1/3P1k1p/P2P3b/2K2PP1/R6R b",
+		"1rb1kb2/p1pppprp/1p4p1/8/3P4/1PP1B3/P3PPPP/R3KBR1 b",
+		"1rb1k3/p1pp1pr1/1p2p2p/2b3p1/1P1P4/P1P1B3/4PPPP/R3KBR1 w",
+		"1rbk4/p1pp1p2/2P1p2p/1p4r1/2PP2p1/P7/4PPPP/2BRKB1R b",
+		"1r1k4/p1pp2r1/b1P1pp2/7p/2pP1Bp1/P2K3P/4PPP1/3R1BR1 w",
+		"8/p1k5/b1Ppppr1/7p/3P2p1/PrpK2BP/4PPP1/1R3BR1 b",
+		"r1b1kb1r/1pp3p1/p2ppp1p/8/6B1/4P1P1/PPPP1P1P/R1BK3R b",
+		"3k1br1/rb4p1/pppppp1p/7B/8/P3PPP1/1PPP3P/R1B2K1R w",
+		"2bk1b1r/4r1pB/ppp1p2p/3p4/8/PP2PPP1/2PP3P/R1B3KR b",
+		"6r1/1br2kp1/ppp1p1Bp/2bp4/P5P1/1P2PP1K/2PP3P/R1B4R w",
+		"6r1/1br2k2/1pp1p1pp/p7/P2PBbP1/1P3PK1/2PP3P/R1B3R1 b",
+		"6r1/1br5/1pp1p1kp/p5p1/P2PB1P1/1PP1KP1P/6R1/R1B1b3 w",
+		"2b3r1/4r1k1/1pp1p3/p5pp/P2PK1P1/1PP2P1P/BR1b4/R1B5 b",
+		"r1bk1b1r/pp2pppp/2pp4/8/8/3P2PP/PPP1PPB1/1RB1KR2 b",
+		"r4b1r/pb2kp1p/1pppp1p1/8/7P/3PPPP1/PPP2RB1/1RBK4 w",
+		"2r2b1r/pb1k1p1p/1pppp1p1/7P/3P2P1/4PP2/PPPK2B1/1RB2R2 b",
+		"5b1r/pb1k1p1p/1p1pp1pP/3r4/2pP2P1/PP2PP2/2P3B1/1RBK1R2 w",
+		"2rk1b2/pb3p1p/1p1pp1pP/1r6/PPpP2P1/4PP2/1RP1K1B1/2B1R3 b",
+	};
+	const int CORPUS_POSITIONS = int(sizeof(s_arrCorpusFen) / sizeof(s_arrCorpusFen[0]));
+
+	/// fixed corpus of whole games for the replay benchmark (same rule as s_arrCorpusFen)
+	const char *s_arrCorpusGames[] =
+	{
+		"E2,E3 F7,F6 F1,E2 E8,D8 E3,E4 H7,H6 E2,F1 C7,C6 H2,H3 H8,H7 D2,D3 A8,B8"
+		" H1,H2 H7,H8 E4,E5 B7,B6 C1,F4 E7,E6 E1,D1 C8,A6 F2,F3 G7,G6 A2,A3 D8,E8"
+		" A3,A4 C6,C5 H3,H4 F8,D6 F4,E3 B8,A8 A1,A2 E8,D8 H4,H5 A6,C4 D1,D2 D8,E7"
+		" H2,H1 F6,F5 D3,C4 D6,E5 E3,G1 G6,H5 G2,G3 A8,C8 F1,E2 E7,E8 D2,E3 B6,B5"
+		" F3,F4 E5,G7 E2,F3 G7,B2 A2,A1 C8,B8 A1,E1 B2,D4 F3,G2 D4,E5 E1,B1 B8,D8"
+		" G2,F1 D8,C8 B1,C1 B5,C4 H1,H3 C8,A8 F4,E5 C4,C3 E3,D3 A8,D8 D3,C4 E8,F7"
+		" C1,B1 F7,F6 C4,B4 D8,F8 B4,B3 F8,F7 A4,A5 F6,E7 F1,E2 H8,C8 H3,H4 C8,G8"
+		" B1,C1 G8,B8 G1,F2 B8,A8 H4,D4 F7,H7 F2,G1 A8,E8 B3,A4 E8,C8 D4,G4 C8,C6"
+		" A4,B3 E7,F7 G4,C4 F7,E8 E2,F1 D7,D6 G3,G4 F5,G4 C4,D4 E8,E7 D4,D3 A7,A6"
+		" D3,D4 E7,D8 D4,D5 H7,E7 F1,E2 E7,A7 B3,A4 D8,E8 G1,D4 A7,G7 A4,B4 E6,D5"
+		"",
+		"E2,E3 B7,B6 F1,C4 A8,B8 H1,G1 F7,F6 A1,B1 C8,B7 E1,E2 E8,F7 E2,F3 B8,C8"
+		" C4,B3 F7,G8 B3,A4 A7,A6 B2,B3 B6,B5 B3,B4 B7,A8 F3,G4 E7,E6 C2,C3 A6,A5"
+		" G4,G5 F6,F5 B4,A5 F8,E7 E3,E4 E7,G5",
+		"E1,D1 G7,G6 G2,G3 G6,G5 D1,E1 F7,F6 E1,D1 A7,A6 E2,E3 C7,C6 F1,B5 F8,H6"
+		" H1,E1 B7,B6 C2,C3 C6,B5 E1,E2 H8,F8 H2,H3 G5,G4 E2,E1 H6,F4 E3,E4 A8,B8"
+		" A2,A3 E7,E6 C3,C4 B8,A8 E1,G1 F4,E3 G1,E1 E3,G5 H3,H4 H7,H6 E1,F1 D7,D6"
+		" F1,G1 D6,D5 G1,G2 H6,H5 C4,D5 E8,D7 D1,E1 D7,C7 D2,D3 F8,H8 D3,D4 C7,D8"
+		" A1,B1 H8,E8 G2,H2 E6,E5 C1,G5 E5,D4 E1,E2 E8,F8 B2,B3 C8,E6 G5,F6 E6,C8"
+		" F6,H8 A8,B8 B3,B4 D8,E8 E2,D3 F8,F3 H8,F6 C8,F5 A3,A4 F3,D3",
+		"B2,B3 B7,B6 E2,E3 H8,G8 E1,E2 E8,D8 H2,H3 D8,E8 D2,D3 F7,F6 A1,B1 E8,F7"
+		" H1,G1 F7,E8 C2,C3 C7,C6 E3,E4 H7,H6 E2,D1 H6,H5 D1,E2 C6,C5 D3,D4 F6,F5"
+		" E2,D2 E7,E6 G2,G3 E8,F7 F1,B5 G8,H8 B5,A4 C5,C4 D2,D3 F5,F4 B3,B4 G7,G6"
+		" G3,G4 F7,G8 G1,D1 H5,H4 A4,B5 H8,H5 D3,C4 C8,A6 B5,A6 H5,D5 D1,H1 D5,A5"
+		" B1,B2 A5,D5 B2,E2 F8,G7 C1,D2 D7,D6 A6,C8 D5,F5 C4,C5 F5,F8 D2,E3 D6,D5"
+		" C5,B6 F8,C8 H1,D1 A7,B6",
+		"B2,B3 H8,G8 F2,F3 D7,D6 E1,F2 C8,F5 H2,H3 A8,C8 B3,B4 E8,D7 C1,A3 D7,C6"
+		" A3,C1 C8,D8 F2,G3 D8,E8 C1,A3 F5,G6 A3,B2 G6,D3 C2,C3 E8,A8 A1,D1 D3,B5"
+		" D1,B1 C6,D7 G3,H2 F7,F6 B2,A3 F6,F5 H2,G3 B5,C6 F3,F4 H7,H6 H1,H2 E7,E6"
+		" B1,B2 C6,F3 G3,G4 G7,G6 B2,B3 F5,G4",
+		"G2,G3 A8,B8 F1,H3 E8,D8 E1,D1 E7,E6 H3,G2 E6,E5 G2,E4 F8,E7 H1,E1 E7,A3"
+		" E1,H1 D8,E8 B2,A3 E8,D8 E2,E3 C7,C6 C1,B2 D8,C7 B2,C3 H7,H6 E4,D3 H8,F8"
+		" C3,D4 D7,D6 D3,A6 C8,F5 D1,E1 F5,C2 A6,D3 B7,B6 E3,E4 C6,C5 G3,G4 B8,C8"
+		" E1,D1 C2,D1",
+		"H2,H3 B7,B6 A1,B1 E7,E6 H1,G1 E8,D8 B1,A1 A8,B8 D2,D3 B6,B5 C1,G5 B5,B4"
+		" G5,E7 D7,D6 F2,F3 B8,B5 E7,D6 C7,C6 D6,C7 B5,B6 D3,D4 F8,C5 E1,D1 C5,D6"
+		" D1,D2 C6,C5 G2,G3 F7,F6 E2,E3 C8,B7 D4,D5 B7,A8 F1,C4 D8,D7 G1,D1 F6,F5"
+		" C7,D6 B6,B5 D2,C1 D7,E7 C4,E2 B4,B3 D1,E1 A8,D5 C1,D1 E6,E5 A1,B1 A7,A6"
+		" H3,H4 D5,F3 H4,H5 E5,E4 C2,C3 E7,F8 E2,C4 H7,H6 C4,D5 F8,E7 D6,C5 E7,F7"
+		" E1,H1 H8,C8 H1,E1 B5,B6 D5,E6 B6,B7 E6,F7",
+		"C2,C3 E7,E6 B2,B3 C7,C6 D2,D3 E8,E7 E1,D1 A7,A6 C1,H6 A6,A5 H6,D2 E7,F6"
+		" G2,G3 F6,G5 F1,H3 G5,H6 F2,F3 H6,G6 D1,E1 G6,G5 H3,F5 F8,C5 E1,F2 H8,F8"
+		" H2,H3 G5,G6 H3,H4 A8,A7 A1,C1 C5,B4 C1,C2 B7,B6 H1,B1 A7,A6 B1,A1 F8,G8"
+		" E2,E3 E6,E5 C3,C4 G6,H6 F3,F4 B4,C5 F5,H7 C5,E3 A1,H1 E3,F4 H7,F5 C6,C5"
+		" H1,H3 H6,G5 C2,C3 G5,F5 C3,C2 D7,D6 G3,G4 C8,B7 C2,C1 G8,E8 D2,A5 E8,E7"
+		" C1,G1 E7,D7 F2,E3 B7,H1 H4,H5 B6,A5 B3,B4 D7,C7 B4,A5 H1,G2 H3,H4 A6,C6"
+		" E3,E4 C7,A7 G1,C1 G2,F3 H4,H1 A7,E7 H5,H6 F7,F6 H1,H4 F5,G5 H6,G7 F3,H1"
+		" E4,F4 G5,F4",
+	};
+	const int CORPUS_GAMES = int(sizeof(s_arrCorpusGames) / sizeof(s_arrCorpusGames[0]));
+
+	/// shortest time of a repetition (passes over the corpus are repeated until then)
+	const double MIN_REP_SECONDS = 0.05;
+
+	/// @brief		command line options of chess_bench
+	struct SBenchOptions
+	{
+		int nWarmup;			///< untimed repetitions before the timed ones (--warmup N)
+		int nReps;				///< timed repetitions; the median is reported (--reps N)
+		int nDepth;				///< depth of the search benchmark (--depth N)
+		const char *szFilter;	///< run only benchmarks whose name contains this (--filter TEXT)
+		const char *szNnue;		///< network file of the network benchmarks (--nnue FILE)
+
+		SBenchOptions() : nWarmup(1), nReps(5), nDepth(5), szFilter(0), szNnue(0) {}
+	};
+
+	/// @brief		corpus and everything the benchmarks need, built before any timing
+	struct SBenchCorpus
+	{
+		std::vector<CPosition> vPos;						///< positions of s_arrCorpusFen
+		std::vector<CChessBoard*> vBoard;					///< a board on each position (for Update())
+		std::vector<std::pair<int, CChessPiece*>> vPieces[TYPE_NB];	///< (position, piece) of each type
+		std::vector<std::vector<CChessPiece*>> vToMove;		///< pieces of the side to move of each position
+		std::vector<CMoveList> vMoves;						///< possible moves of each position
+		std::vector<CPosition> vBatchPos;					///< positions after each possible move
+		SPositionBatch batch;								///< vBatchPos for EvaluateBatch()
+		std::vector<int> vScores;							///< scores of the batch
+		const CNnue *pNnue;									///< network (0 without --nnue)
+		int nDepth;											///< depth of the search benchmark
+		uint64_t nSink;										///< results folded together (keeps them alive)
+	};
+
+	/// @brief		make an instance of a piece of the CChessPiece hierarchy (the virtual baseline)
+	/// @return		the piece (to be deleted by the caller)
+	CChessPiece*
+	CreatePiece(const char cColor, const char cName, const char cCol, const char cRow)
+	{
+		switch (NameToType(cName))
+		{
+		case TYPE_KING:	return new CChessPieceKing(cColor, cName, cCol, cRow);
+		case TYPE_ROOK:	return new CChessPieceRook(cColor, cName, cCol, cRow);
+		case TYPE_BISH:	return new CChessPieceBish(cColor, cName, cCol, cRow);
+		case TYPE_PAWN:
+		default:		return new CChessPiecePawn(cColor, cName, cCol, cRow);
+		}
+	}
+
+	/// @brief		one pass of a benchmark over the corpus
+	/// @return		the number of operations of the pass
+	typedef uint64_t (*PfnBench)(SBenchCorpus& corpus);
+
+	/// @brief		CChessPiece::GetPossiblePos() of every piece of a type
+	template<int Type>
+	uint64_t
+	BenchPossiblePos(SBenchCorpus& corpus)
+	{
+		const std::vector<std::pair<int, CChessPiece*>>& vPieces = corpus.vPieces[Type];
+
+		for (size_t i = 0; i < vPieces.size(); i++)
+			corpus.nSink += vPieces[i].second->GetPossiblePos(corpus.vPos[vPieces[i].first]).size();
+
+		return vPieces.size();
+	}
+
+	/// @brief		moves of the side to move through the virtual CChessPiece::GetTargets()
+	uint64_t
+	BenchGenerateMovesVirtual(SBenchCorpus& corpus)
+	{
+		for (size_t i = 0; i < corpus.vPos.size(); i++)
+		{
+			CMoveList list;
+			const std::vector<CChessPiece*>& vPieces = corpus.vToMove[i];
+			for (size_t j = 0; j < vPieces.size(); j++)
+				vPieces[j]->GenerateMoves(corpus.vPos[i], list);
+			corpus.nSink += uint64_t(list.Size());
+		}
+
+		return corpus.vPos.size();
+	}
+
+	/// @brief		GenerateMoves() of the side to move (GenerateMoves<Type, Side> for each type)
+	uint64_t
+	BenchGenerateMoves(SBenchCorpus& corpus)
+	{
+		for (size_t i = 0; i < corpus.vPos.size(); i++)
+		{
+			CMoveList list;
+			GenerateMoves(corpus.vPos[i], list);
+			corpus.nSink += uint64_t(list.Size());
+		}
+
+		return corpus.vPos.size();
+	}
+
+	/// @brief		'In check' of both sides (as CChessBoard::ShowBoard() asks it)
+	uint64_t
+	BenchIsInCheck(SBenchCorpus& corpus)
+	{
+		for (size_t i = 0; i < corpus.vPos.size(); i++)
+		{
+			const CPosition& pos = corpus.vPos[i];
+			corpus.nSink += (pos.IsInCheck(SIDE_WHITE) || pos.IsInCheck(SIDE_BLACK)) ? 1 : 0;
+		}
+
+		return corpus.vPos.size();
+	}
+
+	/// @brief		CChessBoard::MakeDecision() rules
+	uint64_t
+	BenchDecision(SBenchCorpus& corpus)
+	{
+		for (size_t i = 0; i < corpus.vPos.size(); i++)
+			corpus.nSink += uint64_t(CChessBoard::Decide(corpus.vPos[i]));
+
+		return corpus.vPos.size();
+	}
+
+	/// @brief		CChessBoard::Update() (rebuild of the board to show)
+	uint64_t
+	BenchUpdate(SBenchCorpus& corpus)
+	{
+		for (size_t i = 0; i < corpus.vBoard.size(); i++)
+			corpus.vBoard[i]->Update();
+
+		return corpus.vBoard.size();
+	}
+
+	/// @brief		make, evaluate, and unmake every possible move (one operation is one move)
+	/// @remark		Full = false reads the score kept by make/unmake, Full = true recomputes it
+	template<bool Full>
+	uint64_t
+	BenchEvaluate(SBenchCorpus& corpus)
+	{
+		uint64_t nMoves = 0;
+		SUndoInfo undo;
+
+		for (size_t i = 0; i < corpus.vPos.size(); i++)
+		{
+			CPosition& pos = corpus.vPos[i];
+			const CMoveList& list = corpus.vMoves[i];
+
+			for (int j = 0; j < list.Size(); j++)
+			{
+				pos.MakeMove(list[j], undo);
+				corpus.nSink += uint64_t(Full ? EvaluateFull(pos) : Evaluate(pos));
+				pos.UnmakeMove(list[j], undo);
+			}
+
+			nMoves += uint64_t(list.Size());
+		}
+
+		return nMoves;
+	}
+
+	/// @brief		make, update the network accumulator, evaluate, and unmake every possible move
+	///				(one operation is one move; no operation without --nnue)
+	uint64_t
+	BenchEvaluateNnue(SBenchCorpus& corpus)
+	{
+		if (!corpus.pNnue)
+			return 0;
+
+		uint64_t nMoves = 0;
+		SUndoInfo undo;
+		SNnueAccumulator accRoot, acc;
+
+		for (size_t i = 0; i < corpus.vPos.size(); i++)
+		{
+			CPosition& pos = corpus.vPos[i];
+			const CMoveList& list = corpus.vMoves[i];
+			corpus.pNnue->Refresh(pos, accRoot);
+
+			for (int j = 0; j < list.Size(); j++)
+			{
+				pos.MakeMove(list[j], undo);
+				corpus.pNnue->Update(accRoot, acc, pos, list[j], undo);
+				corpus.nSink += uint64_t(corpus.pNnue->Evaluate(acc, pos.GetSide()));
+				pos.UnmakeMove(list[j], undo);
+			}
+
+			nMoves += uint64_t(list.Size());
+		}
+
+		return nMoves;
+	}
+
+	/// @brief		EvaluateFull() of each position of the batch, one at a time
+	uint64_t
+	BenchEvaluateEach(SBenchCorpus& corpus)
+	{
+		for (size_t i = 0; i < corpus.vBatchPos.size(); i++)
+			corpus.nSink += uint64_t(EvaluateFull(corpus.vBatchPos[i]));
+
+		return corpus.vBatchPos.size();
+	}
+
+	/// @brief		EvaluateBatch() with an instruction set (no operation if the CPU lacks it)
+	template<int Isa>
+	uint64_t
+	BenchEvaluateBatch(SBenchCorpus& corpus)
+	{
+		if (!IsBatchIsaSupported(Isa))
+			return 0;
+
+		EvaluateBatch(corpus.batch, &corpus.vScores[0], Isa);
+		corpus.nSink += uint64_t(corpus.vScores[corpus.vScores.size() / 2]);
+
+		return corpus.vScores.size();
+	}
+
+	/// @brief		See() of every possible capture (one operation is one capture)
+	uint64_t
+	BenchSee(SBenchCorpus& corpus)
+	{
+		uint64_t nCaptures = 0;
+
+		for (size_t i = 0; i < corpus.vPos.size(); i++)
+		{
+			const CMoveList& list = corpus.vMoves[i];
+
+			for (int j = 0; j < list.Size(); j++)
+			{
+				if (IsCapture(list[j]))
+				{
+					corpus.nSink += uint64_t(See(corpus.vPos[i], list[j]));
+					nCaptures++;
+				}
+			}
+		}
+
+		return nCaptures;
+	}
+
+	/// @brief		replay of whole games (one operation is one move)
+	uint64_t
+	BenchReplay(SBenchCorpus& corpus)
+	{
+		CPosition posStart;
+		posStart.SetStartPos();
+		uint64_t nMoves = 0;
+
+		for (int i = 0; i < CORPUS_GAMES; i++)
+		{
+			SReplayResult result;
+			const char *p = s_arrCorpusGames[i];
+			ReplayGame(posStart, p, p + strlen(p), result);
+			nMoves += uint64_t(result.nMoves);
+			corpus.nSink += uint64_t(result.cCode);
+		}
+
+		return nMoves;
+	}
+
+	/// @brief		fixed-depth search without a transposition table (one operation is one node)
+	uint64_t
+	BenchSearch(SBenchCorpus& corpus)
+	{
+		CSearch search;
+		SSearchLimits limits;
+		limits.nDepth = corpus.nDepth;
+		uint64_t nNodes = 0;
+
+		for (size_t i = 0; i < corpus.vPos.size(); i++)
+		{
+			SSearchResult result = search.Go(corpus.vPos[i], limits);
+			nNodes += result.nNodes;
+			corpus.nSink += result.bestMove;
+		}
+
+		return nNodes;
+	}
+
+	/// @brief		a named benchmark
+	struct SBenchCase
+	{
+		const char *szName;		///< name (also matched by --filter)
+		const char *szOp;		///< what one operation is
+		PfnBench pfnBench;		///< one pass over the corpus
+	};
+
+	const SBenchCase s_arrCases[] =
+	{
+		{ "possiblepos.king",	"piece",	BenchPossiblePos<TYPE_KING> },
+		{ "possiblepos.rook",	"piece",	BenchPossiblePos<TYPE_ROOK> },
+		{ "possiblepos.bish",	"piece",	BenchPossiblePos<TYPE_BISH> },
+		{ "possiblepos.pawn",	"piece",	BenchPossiblePos<TYPE_PAWN> },
+		{ "generatemoves",		"position",	BenchGenerateMoves },
+		{ "generatemoves.virtual",	"position",	BenchGenerateMovesVirtual },
+		{ "isincheck",			"position",	BenchIsInCheck },
+		{ "decision",			"position",	BenchDecision },
+		{ "update",				"board",	BenchUpdate },
+		{ "evaluate",			"move",		BenchEvaluate<false> },
+		{ "evaluate.full",		"move",		BenchEvaluate<true> },
+		{ "evaluate.nnue",		"move",		BenchEvaluateNnue },
+		{ "evalbatch.each",		"position",	BenchEvaluateEach },
+		{ "evalbatch.scalar",	"position",	BenchEvaluateBatch<BATCH_SCALAR> },
+		{ "evalbatch.ssse3",	"position",	BenchEvaluateBatch<BATCH_SSSE3> },
+		{ "evalbatch.avx2",		"position",	BenchEvaluateBatch<BATCH_AVX2> },
+		{ "see",				"capture",	BenchSee },
+		{ "replay",				"move",		BenchReplay },
+		{ "search",				"node",		BenchSearch },
+	};
+
+	/// @brief		time one repetition: passes over the corpus for at least MIN_REP_SECONDS
+	/// @return		nanoseconds per operation
+	double
+	TimeRepetition(const SBenchCase& bench, SBenchCorpus& corpus)
+	{
+		std::chrono::steady_clock::time_point tBegin = std::chrono::steady_clock::now();
+		uint64_t nOps = 0;
+		double dSec;
+
+		do
+		{
+			nOps += bench.pfnBench(corpus);
+			dSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - tBegin).count();
+		} while (dSec < MIN_REP_SECONDS);
+
+		return dSec * 1e9 / double(nOps ? nOps : 1);
+	}
+
+	/// @brief		read the options of chess_bench
+	bool
+	ParseBenchOptions(int argc, char *argv[], SBenchOptions& opt)
+	{
+		for (int i = 1; i < argc; i++)
+		{
+			if (i + 1 >= argc)
+				return false;
+
+			if (strcmp(argv[i], "--warmup") == 0)
+				opt.nWarmup = atoi(argv[++i]);
+			else if (strcmp(argv[i], "--reps") == 0)
+				opt.nReps = atoi(argv[++i]);
+			else if (strcmp(argv[i], "--depth") == 0)
+				opt.nDepth = atoi(argv[++i]);
+			else if (strcmp(argv[i], "--filter") == 0)
+				opt.szFilter = argv[++i];
+			else if (strcmp(argv[i], "--nnue") == 0)
+				opt.szNnue = argv[++i];
+			else
+				return false;
+		}
+
+		return opt.nWarmup >= 0 && opt.nReps >= 1 && opt.nDepth >= 1;
+	}
+}
+
+/// @brief		main function of chess_bench
+/// @param		argc [in] the number of arguments
+/// @param		argv [in] character array of arguments
+/// @return		0 on success, 1 on a bad corpus or option
+int main(int argc, char *argv[])
+{
+	InstallInstrumentReport();
+
+	SBenchOptions opt;
+	if (!ParseBenchOptions(argc, argv, opt))
+	{
+		std::cerr << "usage: chess_bench [--warmup N] [--reps N] [--depth N] [--filter TEXT] [--nnue FILE]" << std::endl;
+		std::cerr << "       prints the median ns/op of N repetitions (and the fastest/slowest)" << std::endl;
+		return 1;
+	}
+
+	SBenchCorpus corpus;
+	corpus.nDepth = opt.nDepth;
+	corpus.nSink = 0;
+	corpus.pNnue = 0;
+
+	CNnue nnue;
+	if (opt.szNnue)
+	{
+		if (!nnue.Load(opt.szNnue))
+		{
+			std::cerr << "bad network file: " << opt.szNnue << std::endl;
+			return 1;
+		}
+		corpus.pNnue = &nnue;
+	}
+
+	for (int i = 0; i < CORPUS_POSITIONS; i++)
+	{
+		CPosition pos;
+		if (!pos.SetFen(s_arrCorpusFen[i]))
+		{
+			std::cerr << "bad corpus position: " << s_arrCorpusFen[i] << std::endl;
+			return 1;
+		}
+		corpus.vPos.push_back(pos);
+		corpus.vToMove.push_back(std::vector<CChessPiece*>());
+		corpus.vMoves.push_back(CMoveList());
+		GenerateMoves(pos, corpus.vMoves.back());
+
+		for (int j = 0; j < corpus.vMoves.back().Size(); j++)
+		{
+			SUndoInfo undo;
+			pos.MakeMove(corpus.vMoves.back()[j], undo);
+			corpus.vBatchPos.push_back(pos);
+			corpus.batch.Add(pos);
+			pos.UnmakeMove(corpus.vMoves.back()[j], undo);
+		}
+
+		corpus.vBoard.push_back(new CChessBoard);
+		corpus.vBoard.back()->SetPosition(pos);
+
+		for (int sq = 0; sq < SQUARE_NB; sq++)
+		{
+			int side = pos.GetSideAt(sq);
+			if (side < 0)
+				continue;
+
+			int type = pos.GetTypeAt(sq);
+			CChessPiece *pChessPiece = CreatePiece(SideToColor(side), TypeToName(type), \
+				char('A' + SQ_X(sq)), char('1' + SQ_Y(sq)));
+			corpus.vPieces[type].push_back(std::make_pair(int(corpus.vPos.size() - 1), pChessPiece));
+			if (side == pos.GetSide())
+				corpus.vToMove.back().push_back(pChessPiece);
+		}
+	}
+
+	corpus.vScores.resize(corpus.vBatchPos.size());
+
+	std::cout << "corpus: " << CORPUS_POSITIONS << " positions, " << CORPUS_GAMES << " games; " \
+		<< "warmup " << opt.nWarmup << ", reps " << opt.nReps << ", search depth " << opt.nDepth << std::endl;
+	std::cout << "benchmark                  ns/op         ops/s    min ns/op    max ns/op  op" << std::endl;
+
+	for (size_t c = 0; c < sizeof(s_arrCases) / sizeof(s_arrCases[0]); c++)
+	{
+		const SBenchCase& bench = s_arrCases[c];
+		if (opt.szFilter && !strstr(bench.szName, opt.szFilter))
+			continue;
+
+		// a benchmark with no operation doesn't run here (eg. an instruction set the CPU lacks)
+		if (bench.pfnBench(corpus) == 0)
+		{
+			std::cout << std::left << std::setw(22) << bench.szName << std::right << "  n/a" << std::endl;
+			continue;
+		}
+
+		for (int i = 0; i < opt.nWarmup; i++)
+			TimeRepetition(bench, corpus);
+
+		std::vector<double> vNs;
+		for (int i = 0; i < opt.nReps; i++)
+			vNs.push_back(TimeRepetition(bench, corpus));
+		std::sort(vNs.begin(), vNs.end());
+
+		double dMedian = vNs[vNs.size() / 2];
+		std::cout << std::left << std::setw(22) << bench.szName << std::right \
+			<< std::fixed << std::setprecision(1) << std::setw(11) << dMedian \
+			<< std::setprecision(0) << std::setw(14) << 1e9 / dMedian \
+			<< std::setprecision(1) << std::setw(13) << vNs.front() << std::setw(13) << vNs.back() \
+			<< "  " << bench.szOp << std::endl;
+	}
+
+	// the sink is printed so that no benchmark can be optimized away
+	std::cout << "checksum " << corpus.nSink % 1000000007ULL << std::endl;
+
+	for (int type = 0; type < TYPE_NB; type++)
+		for (size_t i = 0; i < corpus.vPieces[type].size(); i++)
+			delete corpus.vPieces[type][i].second;
+	for (size_t i = 0; i < corpus.vBoard.size(); i++)
+		delete corpus.vBoard[i];
+
+	return 0;
+}
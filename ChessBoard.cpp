@@ -3,32 +3,24 @@
 /// @author		Junpyo Hong (jp7.hong@gmail.com)
 /// @date		Nov. 14, 2017
 /// @version	1.0
-/// @brief		Chessboard class (singleton pattern)
+/// @brief		Chessboard class (interactive game on a CPosition)
 /// @remark		Tab size: 4
 ///
 
 #include <iostream>		// std::cout
 #include <string>		// std::getline
-#include <algorithm>	// std::for_each
 #include <cctype>		// toupper, isalpha, isdigit
 #include <cassert>		// assert
 
 #include "ChessBoard.h"
-#include "ChessPieceKing.h"
-#include "ChessPieceRook.h"
-#include "ChessPieceBish.h"
-#include "ChessPiecePawn.h"
+#include "Instrument.h"
 
 /// @brief		constructor
 /// @param		N/A
 /// @return		N/A
 CChessBoard::CChessBoard()
 {
-	// m_nPieces = 13 (King 1, Rook 2, Bishop 2, and Pawn 8)
-	m_vWhite.reserve(m_nPieces);
-	m_vBlack.reserve(m_nPieces);
-
-	// allocate memory and initialize color and position of each pieces
+	// set the initial position
 	Init();
 }
 
@@ -37,71 +29,31 @@ CChessBoard::CChessBoard()
 /// @return		N/A
 CChessBoard::~CChessBoard()
 {
-	// deallocate memory for all pieces
-	Quit();
 }
 
 /// @brief		initialize color and position of each pieces
 /// @param		N/A
 /// @return		void
+/// @remark		the pieces live in the piece list of m_pos (no allocation per piece)
 void
 CChessBoard::Init()
 {
-	// CChessPieceXXXX arguments:
-	// argument 1: 'W'(white) or 'B'(black)
-	// argument 2: 'K'(king), 'R'(rook), 'B'(bishop), or 'P'(pawn)
-	// argument 3: column index ['A'..'H'] (it's a character, not a int)
-	// argument 4: row index ['1'..'8'] (it's a character, not a int)
-
-	// make instances for white pieces
-	m_vWhite.push_back(new CChessPieceKing('W', 'K', 'E', '1'));
-	m_vWhite.push_back(new CChessPieceRook('W', 'R', 'A', '1'));
-	m_vWhite.push_back(new CChessPieceRook('W', 'R', 'H', '1'));
-	m_vWhite.push_back(new CChessPieceBish('W', 'B', 'C', '1'));
-	m_vWhite.push_back(new CChessPieceBish('W', 'B', 'F', '1'));
-	m_vWhite.push_back(new CChessPiecePawn('W', 'P', 'A', '2'));
-	m_vWhite.push_back(new CChessPiecePawn('W', 'P', 'B', '2'));
-	m_vWhite.push_back(new CChessPiecePawn('W', 'P', 'C', '2'));
-	m_vWhite.push_back(new CChessPiecePawn('W', 'P', 'D', '2'));
-	m_vWhite.push_back(new CChessPiecePawn('W', 'P', 'E', '2'));
-	m_vWhite.push_back(new CChessPiecePawn('W', 'P', 'F', '2'));
-	m_vWhite.push_back(new CChessPiecePawn('W', 'P', 'G', '2'));
-	m_vWhite.push_back(new CChessPiecePawn('W', 'P', 'H', '2'));
-
-	// make instances for black pieces
-	m_vBlack.push_back(new CChessPieceKing('B', 'K', 'E', '8'));
-	m_vBlack.push_back(new CChessPieceRook('B', 'R', 'A', '8'));
-	m_vBlack.push_back(new CChessPieceRook('B', 'R', 'H', '8'));
-	m_vBlack.push_back(new CChessPieceBish('B', 'B', 'C', '8'));
-	m_vBlack.push_back(new CChessPieceBish('B', 'B', 'F', '8'));
-	m_vBlack.push_back(new CChessPiecePawn('B', 'P', 'A', '7'));
-	m_vBlack.push_back(new CChessPiecePawn('B', 'P', 'B', '7'));
-	m_vBlack.push_back(new CChessPiecePawn('B', 'P', 'C', '7'));
-	m_vBlack.push_back(new CChessPiecePawn('B', 'P', 'D', '7'));
-	m_vBlack.push_back(new CChessPiecePawn('B', 'P', 'E', '7'));
-	m_vBlack.push_back(new CChessPiecePawn('B', 'P', 'F', '7'));
-	m_vBlack.push_back(new CChessPiecePawn('B', 'P', 'G', '7'));
-	m_vBlack.push_back(new CChessPiecePawn('B', 'P', 'H', '7'));
+	m_pos.SetStartPos();
 
 	// update the board status to show
 	Update();
 }
 
-/// @brief		deallocate memory for all pieces
-/// @param		N/A
+/// @brief		start the game from any position (eg. read by CPosition::SetFen())
+/// @param		pos [in] position
 /// @return		void
+/// @remark		the move history is cleared
 void
-CChessBoard::Quit()
+CChessBoard::SetPosition(const CPosition& pos)
 {
-	// deallocate memory for white/black pieces
-	for (int i = 0; i < m_nPieces; i++)
-	{
-		delete m_vWhite[i];
-		delete m_vBlack[i];
-	}
-
-	m_vWhite.clear();
-	m_vBlack.clear();
+	m_vHistory.clear();
+	m_pos = pos;
+	Update();
 }
 
 /// @brief		main interface function for main.cpp
@@ -120,11 +72,8 @@ void CChessBoard::Run()
 		// change turn if user's command is valid
 		if (CheckMoveRule() == true)
 		{
-			// update position of a piece and remove a enemy if it captured
+			// update position of a piece, remove a enemy if it captured, and change turn
 			PostProcess();
-
-			// change turn
-			m_cTurnColor = (m_cTurnColor == 'W') ? 'B' : 'W';
 		}
 
 		// show board or decision result (return false if the game is terminated)
@@ -143,26 +92,21 @@ CChessBoard::GetTroopsPos(const int color, \
 const std::pair<int, int>& pairPosIgnore)
 {
 	std::vector<std::pair<int, int>> vRet;
-	std::vector<CChessPiece*> *p = 0;
 
 	assert(color == CChessBoard::WHITE || color == CChessBoard::BLACK);
 
-	// set a vector pointer to a proper colored troops
-	p = (color == WHITE) ? &m_vWhite : &m_vBlack;
-
-	std::vector<CChessPiece*>::iterator it;
-	for (it = p->begin(); it != p->end(); ++it)
+	// live pieces of the given colored troops (in piece list order)
+	int side = ColorToSide(char(color));
+	for (int idx = 0; idx < m_pos.GetPieceCount(); idx++)
 	{
-		// if it is a live piece
-		if ((*it)->IsExist())
-		{
-			int x = (*it)->GetPos().first;
-			int y = (*it)->GetPos().second;
+		if (m_pos.GetPieceSide(idx) != side)
+			continue;
 
-			// add only if it is not same position
-			if (std::make_pair(x, y) != pairPosIgnore)
-				vRet.push_back(std::make_pair(x, y));
-		}
+		int sq = m_pos.GetPieceSq(idx);
+
+		// add only if it is not same position
+		if (std::make_pair(SQ_X(sq), SQ_Y(sq)) != pairPosIgnore)
+			vRet.push_back(std::make_pair(SQ_X(sq), SQ_Y(sq)));
 	}
 
 	return vRet;
@@ -181,6 +125,8 @@ CChessBoard::GetInput()
 	std::getline(std::cin, s);
 	std::cout << "====  END GAME INPUT  ====" << std::endl << std::endl;
 
+	INSTRUMENT_SCOPE(CNT_INPUT);
+
 	// get a character from inputted string
 	char col_curr = s[0];
 	char row_curr = s[1];
@@ -210,7 +156,7 @@ CChessBoard::GetInput()
 	// check piece color, existence of the given current position
 	int x = col_curr - 'A';
 	int y = row_curr - '1';
-	if (m_arrSquare[y][x].cColor != m_cTurnColor)
+	if (m_pos.GetSideAt(SQ(x, y)) != m_pos.GetSide())
 		return false;
 
 	// set current/desired positions
@@ -226,35 +172,19 @@ CChessBoard::GetInput()
 bool
 CChessBoard::CheckMoveRule()
 {
-	// pointer of chess piece of user's source index
-	CChessPiece* pChessPiece = \
-		m_arrSquare[GetSrcPos().second][GetSrcPos().first].pChessPiece;
-
-	// if there's no piece at the source position of user's input
-	if (!pChessPiece)
-		return false;
+	int nSrc = SQ(GetSrcPos().first, GetSrcPos().second);
 
-	// check whether piece color is matched
-	if (m_cTurnColor != pChessPiece->GetColor())
+	// if there's no piece at the source position of user's input,
+	// or if the piece color is not matched
+	if (m_pos.GetSideAt(nSrc) != m_pos.GetSide())
 		return false;
 
-	// get possible positions of user's source piece position
-	std::vector<std::pair<int, int>> vPairPossiblePos;
-	vPairPossiblePos = pChessPiece->GetPossiblePos();
-	std::vector<std::pair<int, int>>::iterator it;
-	for (it = vPairPossiblePos.begin(); it != vPairPossiblePos.end(); ++it)
-	{
-		// if a user's desired position is matched according to the move rule
-		if (GetDstPos() == (*it))
-		{
-			return true;
-		}
-	}
-
-	return false;
+	// if a user's desired position is matched according to the move rule
+	Bitboard bbDst = SqBB(SQ(GetDstPos().first, GetDstPos().second));
+	return (m_pos.GetTargets(nSrc) & bbDst) != 0;
 }
 
-/// @brief		remove a enemy if it's captured and move player's piece
+/// @brief		remove a enemy if it's captured, move player's piece, and change turn
 /// @param		N/A
 /// @return		void
 /// @remark		this function must be called when user's move command is valid
@@ -265,14 +195,58 @@ CChessBoard::PostProcess()
 	int srcPosY = GetSrcPos().second;
 	int dstPosX = GetDstPos().first;
 	int dstPosY = GetDstPos().second;
-	char cEnemyColor = (m_cTurnColor == 'W') ? 'B' : 'W';
+	int nDst = SQ(dstPosX, dstPosY);
+
+	SHistory history;
 
-	// if there's a enemy at the desired position, remove it
-	if (m_arrSquare[dstPosY][dstPosX].cColor == cEnemyColor)
-		m_arrSquare[dstPosY][dstPosX].pChessPiece->Remove();
+	// a enemy at the desired position is removed by MakeMove()
+	bool bCapture = (m_pos.GetSideAt(nDst) == (m_pos.GetSide() ^ 1));
 
-	// move a piece to the user's desired position
-	m_arrSquare[srcPosY][srcPosX].pChessPiece->SetPos(dstPosX, dstPosY);
+	// move a piece to the user's desired position (only the two squares change)
+	history.move = PackMove(SQ(srcPosX, srcPosY), nDst, bCapture ? MOVE_CAPTURE : MOVE_QUIET);
+	m_pos.MakeMove(history.move, history.undo);
+	m_arrSquare[dstPosY][dstPosX] = m_arrSquare[srcPosY][srcPosX];
+	m_arrSquare[srcPosY][srcPosX].cColor = NO_COLOR;
+	m_arrSquare[srcPosY][srcPosX].cName = '.';
+
+	m_vHistory.push_back(history);
+}
+
+/// @brief		take back the latest move played by PostProcess()
+/// @param		N/A
+/// @return		true if a move was taken back, false if there's no move to take back
+bool
+CChessBoard::UndoMove()
+{
+	if (m_vHistory.empty())
+		return false;
+
+	SHistory& history = m_vHistory.back();
+	int srcPosX = SQ_X(MoveFrom(history.move));
+	int srcPosY = SQ_Y(MoveFrom(history.move));
+	int dstPosX = SQ_X(MoveTo(history.move));
+	int dstPosY = SQ_Y(MoveTo(history.move));
+
+	m_pos.UnmakeMove(history.move, history.undo);
+
+	// move the piece back to its source position
+	m_arrSquare[srcPosY][srcPosX] = m_arrSquare[dstPosY][dstPosX];
+
+	// put the captured enemy back, or clear the destination square
+	if (history.undo.nCaptured != TYPE_NONE)
+	{
+		m_arrSquare[dstPosY][dstPosX].cColor = SideToColor(m_pos.GetSide() ^ 1);
+		m_arrSquare[dstPosY][dstPosX].cName = TypeToName(history.undo.nCaptured);
+	}
+	else
+	{
+		m_arrSquare[dstPosY][dstPosX].cColor = NO_COLOR;
+		m_arrSquare[dstPosY][dstPosX].cName = '.';
+	}
+
+	m_vHistory.pop_back();
+
+	return true;
 }
 
 /// @brief		show game output (display board or result)
@@ -281,6 +255,8 @@ CChessBoard::PostProcess()
 bool
 CChessBoard::ShowOutput()
 {
+	INSTRUMENT_SCOPE(CNT_OUTPUT);
+
 	bool bRet = false;
 
 	std::cout << "==== BEGIN GAME OUTPUT ====" << std::endl;
@@ -316,93 +292,39 @@ CChessBoard::ShowOutput()
 int
 CChessBoard::MakeDecision()
 {
-	// check whether two kings are alive
-	assert(m_vWhite[0]->GetName() == 'K');
-	assert(m_vBlack[0]->GetName() == 'K');
+	return Decide(m_pos);
+}
+
+/// @brief		make a decision on any position (the rules of MakeDecision())
+/// @param		pos [in] position
+/// @return		CONTINUE, WIN_W (white win), WIN_B (black win), or DRAW
+int
+CChessBoard::Decide(const CPosition& pos)
+{
+	INSTRUMENT_SCOPE(CNT_DECISION);
 
 	// (1) if the white king is not exist, then black wins.
-	if (!m_vWhite[0]->IsExist())
+	if (!pos.HasKing(SIDE_WHITE))
 		return WIN_B;
 
 	// (2) if the black king is not exist, then white wins.
-	if (!m_vBlack[0]->IsExist())
+	if (!pos.HasKing(SIDE_BLACK))
 		return WIN_W;
 
-	////////////////////////////////////////////////////////////////////////////
-	// (3) check if the 'stalemate' has happened
-
-	// set the troops pointers according to the turn
-	std::vector<CChessPiece*> *pTroops[2] = { 0, 0 };
-	pTroops[0] = (m_cTurnColor == WHITE) ? &m_vWhite : &m_vBlack;
-	pTroops[1] = (m_cTurnColor == WHITE) ? &m_vBlack : &m_vWhite;
-
-	// the pTroops[0] king's possible position
-	std::vector<std::pair<int, int>> vPairPosKingPossiblePos = \
-		pTroops[0]->at(0)->GetPossiblePos();
-
-	// possible positions of all pTroops[1] pieces
-	std::vector<std::pair<int, int>> vPairPosEnemiesPossiblePos;
-	for (size_t i = 0; i < pTroops[1]->size(); i++)
-	{
-		if (!pTroops[1]->at(i)->IsExist())
-			continue;
-
-		// possible positions of a pTroops[1] piece
-		std::vector<std::pair<int, int>> vPairPosEnemyPossiblePos = \
-			pTroops[1]->at(i)->GetPossiblePos();
-
-		// possible positions of all pTroops[1] pieces
-		vPairPosEnemiesPossiblePos.insert(vPairPosEnemiesPossiblePos.end(), \
-			vPairPosEnemyPossiblePos.begin(), vPairPosEnemyPossiblePos.end());
-	}
-
-	// check if the king can avoid
-	bool bKingCanMove = true;
-	for (size_t i = 0; i < vPairPosKingPossiblePos.size(); i++)
-	{
-		// compare with each enemy's possible positions
-		for (size_t j = 0; j < vPairPosEnemiesPossiblePos.size(); j++)
-		{
-			// if this square is a dangerous square
-			if (vPairPosKingPossiblePos[i] == vPairPosEnemiesPossiblePos[j])
-			{
-				bKingCanMove = false;
-				break;
-			}
-		}
-
-		if (bKingCanMove)
-			return CONTINUE;
-	}
-
-	// if pTroop[0] king cannot move, then check if other pieces can move
-	if (!bKingCanMove)
-	{
-		for (size_t i = 1; i < pTroops[0]->size(); i++)
-		{
-			std::vector<std::pair<int, int>> vPairPos = \
-				pTroops[0]->at(i)->GetPossiblePos();
-
-			// if it is possible to move at least one piece, it's not 'statemate'
-			if (vPairPos.size() > 0)
-				return CONTINUE;
-		}
-	}
+	// (3) 'stalemate': the king can only move into attack and no other piece can move
+	if (pos.IsStalemate())
+		return DRAW;
 
-	////////////////////////////////////////////////////////////////////////////
-
-	return DRAW;
+	return CONTINUE;
 }
 
-/// @brief		update chessboard state and show the board
+/// @brief		show the board
 /// @param		N/A
 /// @return		void
+/// @remark		m_arrSquare is kept up to date by Init(), PostProcess(), and UndoMove()
 void
 CChessBoard::ShowBoard()
 {
-	// update the board status to show
-	Update();
-
 	std::cout << "  -----------------------" << std::endl;
 
 	for (int y = BOARD_LEN - 1; y >= 0; y--)
@@ -424,46 +346,33 @@ CChessBoard::ShowBoard()
 	std::cout << "  -----------------------" << std::endl;
 	std::cout << "  A  B  C  D  E  F  G  H" << std::endl;
 	std::cout << "In check: " << (IsInCheck() ? "Y" : "N") << std::endl;
-	std::cout << "Next move: " << m_cTurnColor << std::endl;	// add "Next" not to confuse
+	std::cout << "Next move: " << GetTurnColor() << std::endl;	// add "Next" not to confuse
 }
 
-/// @brief		update the chessboard status to show
+/// @brief		rebuild the chessboard status to show from the position
 /// @param		N/A
 /// @return		void
 void
 CChessBoard::Update()
 {
-	// clear board array to get new position information of pieces
+	INSTRUMENT_SCOPE(CNT_UPDATE);
+
+	// clear every square, then place the pieces of the piece list
 	for (int y = 0; y < BOARD_LEN; y++)
 	{
 		for (int x = 0; x < BOARD_LEN; x++)
 		{
-			m_arrSquare[y][x].cColor = '.';
+			m_arrSquare[y][x].cColor = NO_COLOR;
 			m_arrSquare[y][x].cName = '.';
-			m_arrSquare[y][x].pChessPiece = 0;
 		}
 	}
 
-	// search live white/black pieces and update chessboard state
-	for (size_t i = 0; i < 2; i++)
+	for (int idx = 0; idx < m_pos.GetPieceCount(); idx++)
 	{
-		std::vector<CChessPiece*> *pTroops = \
-			(i == 0) ? &m_vWhite : &m_vBlack;
+		int sq = m_pos.GetPieceSq(idx);
 
-		std::vector<CChessPiece*>::iterator it;
-		for (it = pTroops->begin(); it != pTroops->end(); ++it)
-		{
-			if ((*it)->IsExist())
-			{
-				int x = (*it)->GetPos().first;
-				int y = (*it)->GetPos().second;
-
-				// set color and name
-				m_arrSquare[y][x].cColor = (*it)->GetColor();
-				m_arrSquare[y][x].cName = (*it)->GetName();
-				m_arrSquare[y][x].pChessPiece = *it;
-			}
-		}
+		m_arrSquare[SQ_Y(sq)][SQ_X(sq)].cColor = SideToColor(m_pos.GetPieceSide(idx));
+		m_arrSquare[SQ_Y(sq)][SQ_X(sq)].cName = TypeToName(m_pos.GetPieceType(idx));
 	}
 }
 
@@ -473,50 +382,16 @@ CChessBoard::Update()
 bool
 CChessBoard::IsInCheck()
 {
-	// check whether the two kings are alive.
-	assert(m_vWhite[0]->GetName() == 'K');
-	assert(m_vBlack[0]->GetName() == 'K');
+	INSTRUMENT_SCOPE(CNT_IS_IN_CHECK);
 
 	// Because I don't consider following rules
 	// "The king cannot move where it would place itself in check." and
 	// "The king cannot capture the opposing king.",
 	// so it needs to check 'In check' state for both sides.
-
-	for (size_t i = 0; i < 2; i++)
+	for (int side = 0; side < SIDE_NB; side++)
 	{
-		// set pointer of friendly/enemy troops
-		std::vector<CChessPiece*> *pFriendlyTroops = 0;
-		std::vector<CChessPiece*> *pEnemyTroops = 0;
-		pFriendlyTroops = (i == 0) ? &m_vWhite : &m_vBlack;
-		pEnemyTroops = (i == 0) ? &m_vBlack : &m_vWhite;
-
-		// the king's position to check
-		//std::pair<int, int> pairKingPos = pFriendlyTroops[0].at(0)->GetPos();
-		std::pair<int, int> pairKingPos = pFriendlyTroops->at(0)->GetPos();
-
-		// check 'In check' possibility
-		std::vector<CChessPiece*>::iterator itEnemy = pEnemyTroops->begin();
-		for (; itEnemy < pEnemyTroops->end(); ++itEnemy)
-		{
-			if ((*itEnemy)->IsExist())
-			{
-				// possible positions where a enemy can move
-				std::vector<std::pair<int, int>> vPairEnemyAttackablePos = \
-					(*itEnemy)->GetPossiblePos();
-
-				// check whether the king can be caught
-				// for each possible position by the enemy
-				std::vector<std::pair<int, int>>::iterator it;
-				it = vPairEnemyAttackablePos.begin();
-				for (; it != vPairEnemyAttackablePos.end(); ++it)
-				{
-					// if the king's current position is overlapped
-					// with a possible position
-					if (pairKingPos == *it)
-						return true;
-				}
-			}
-		}
+		if (m_pos.IsInCheck(side))
+			return true;
 	}
 
 	return false;
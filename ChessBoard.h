@@ -3,7 +3,7 @@
 /// @author		Junpyo Hong (jp7.hong@gmail.com)
 /// @date		Nov. 15, 2017
 /// @version	1.0
-/// @brief		Chessboard class (singleton pattern)
+/// @brief		Chessboard class (interactive game on a CPosition)
 /// @remark		Tab size: 4
 ///
 
@@ -13,16 +13,10 @@
 #include <vector>		// std::vector
 #include <utility>		// std::pair, std::make_pair
 
-#include "Singleton.h"
-#include "ChessPiece.h"
+#include "Position.h"
 
-/// length of column and row
-#ifndef BOARD_LEN
-#define BOARD_LEN	(8)
-#endif
-
-/// @brief		Chessboard class (singleton pattern)
-class CChessBoard : public TSingleton<CChessBoard>
+/// @brief		Chessboard class (interactive game on a CPosition)
+class CChessBoard
 {
 public:
 	enum EPieceColor { NO_COLOR = '.', WHITE = 'W', BLACK = 'B' };
@@ -33,9 +27,19 @@ public:
 	virtual ~CChessBoard();
 
 	void Run();
+	bool UndoMove();
+	void SetPosition(const CPosition& pos);
+
+	static int Decide(const CPosition& pos);
+	void Update();
 
-	char GetTurnColor() { return m_cTurnColor; }
-	char GetPosColor(const int x, const int y) { return m_arrSquare[y][x].cColor; }
+	const CPosition& GetPosition() const { return m_pos; }
+	char GetTurnColor() { return SideToColor(m_pos.GetSide()); }
+	char GetPosColor(const int x, const int y)
+	{
+		int side = m_pos.GetSideAt(SQ(x, y));
+		return (side < 0) ? char(NO_COLOR) : SideToColor(side);
+	}
 	std::pair<char, char> GetSrcIdx() { return m_pairSrcIdx; }
 	std::pair<char, char> GetDstIdx() { return m_pairDstIdx; }
 	std::pair<int, int> GetSrcPos()
@@ -54,14 +58,12 @@ public:
 
 private:
 	void Init();
-	void Quit();
 	bool GetInput();
 	bool CheckMoveRule();
 	void PostProcess();
 	bool ShowOutput();
 	int  MakeDecision();
 	void ShowBoard();
-	void Update();
 	bool IsInCheck();
 
 private:
@@ -72,18 +74,21 @@ private:
 	const CChessBoard& operator=(const CChessBoard&);
 
 private:
+	typedef struct _tagSHistory
+	{
+		Move move;							///< move played by PostProcess()
+		SUndoInfo undo;						///< information to take back the move (captured type included)
+	} SHistory;
+
 	typedef struct _tagSBoardGrid
 	{
 		char cColor;						///< color of a piece ('W' or 'B')
 		char cName;							///< name of a piece ('K', 'R', 'B', or 'P')
-		CChessPiece *pChessPiece;			///< pointer to access a chess piece
 	} SBoardGrid;
 
-	const int m_nPieces = 13;				///< the number of pieces of a team
-	char m_cTurnColor = WHITE;				///< current turn (WHITE('W') or BLACK('B'))
-	std::vector<CChessPiece*> m_vWhite;		///< vector to hold white pieces
-	std::vector<CChessPiece*> m_vBlack;		///< vector to hold black pieces
-	SBoardGrid m_arrSquare[BOARD_LEN][BOARD_LEN];	///< matrix to show the chessboard
+	CPosition m_pos;						///< bitboards, piece list, and turn (authoritative state)
+	SBoardGrid m_arrSquare[BOARD_LEN][BOARD_LEN];	///< matrix to show the chessboard (derived from m_pos)
+	std::vector<SHistory> m_vHistory;		///< played moves, latest last
 	std::pair<char, char> m_pairSrcIdx;		///< user's source index (eg. "A2")
 	std::pair<char, char> m_pairDstIdx;		///< user's destination index (eg. "A3")
 };
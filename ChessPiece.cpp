@@ -8,3 +8,35 @@
 ///
 
 #include "ChessPiece.h"
+#include "MoveGen.h"		// SerializeMoves
+
+/// @brief		get possible positions of this piece
+/// @param		pos [in] position which this piece belongs to
+/// @return		position vector which contains possible positions
+/// @remark		converts GetTargets() of the derived class into (x, y) pairs
+std::vector<std::pair<int, int>>
+CChessPiece::GetPossiblePos(const CPosition& pos)
+{
+	std::vector<std::pair<int, int>> vRet;
+
+	Bitboard bbTargets = GetTargets(pos);
+	while (bbTargets)
+	{
+		int sq = PopLsb(bbTargets);
+		vRet.push_back(std::make_pair(SQ_X(sq), SQ_Y(sq)));
+	}
+
+	return vRet;
+}
+
+/// @brief		append the moves of this piece to a caller-owned list (no allocation)
+/// @param		pos [in] position which this piece belongs to
+/// @param		list [out] move list
+/// @return		void
+void
+CChessPiece::GenerateMoves(const CPosition& pos, CMoveList& list)
+{
+	Bitboard bbEnemy = pos.GetSideBB(ColorToSide(m_cColor) ^ 1);
+
+	SerializeMoves(SQ(m_pairPos.first, m_pairPos.second), GetTargets(pos), bbEnemy, list);
+}
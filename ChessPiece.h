@@ -3,7 +3,8 @@
 /// @author		Junpyo Hong (jp7.hong@gmail.com)
 /// @date		Nov. 14, 2017
 /// @version	1.0
-/// @brief		abstract class for chess piece types (strategy pattern)
+/// @brief		abstract class for chess piece types (strategy pattern), kept only as the
+///				virtual-call baseline of chess_bench (the game keeps its pieces in CPosition)
 /// @remark		Tab size: 4
 ///
 
@@ -15,10 +16,10 @@
 #include <cassert>		// assert (used at derived class)
 #include <cstddef>		// size_t (used at derived class)
 
-/// length of column and row
-#ifndef BOARD_LEN
-#define BOARD_LEN	(8)
-#endif
+#include "Bitboard.h"	// Bitboard
+#include "Move.h"		// CMoveList
+
+class CPosition;
 
 /// check if a given position is valid
 #define IS_POS_WITHIN_RANGE(x,y) \
@@ -32,18 +33,18 @@ public:
 		const char col, const char row)
 	: m_cColor(cColor)
 	, m_cName(cName)
-	, m_bExist(true)
 	, m_pairPos(std::make_pair(col - 'A', row - '1')) {}
 	virtual ~CChessPiece() {}
 
 	char GetColor() { return m_cColor; }
 	char GetName() { return m_cName; }
-	bool IsExist() { return m_bExist; }
-	void Remove() { m_bExist = false; }
 	std::pair<int, int> GetPos() { return m_pairPos; }
 	void SetPos(const int x, const int y) { m_pairPos = std::make_pair(x, y); }
 
-	virtual std::vector<std::pair<int, int>> GetPossiblePos() = 0;
+	std::vector<std::pair<int, int>> GetPossiblePos(const CPosition& pos);
+	void GenerateMoves(const CPosition& pos, CMoveList& list);
+
+	virtual Bitboard GetTargets(const CPosition& pos) = 0;
 
 private:
 	/// non construction-copyable
@@ -55,7 +56,6 @@ private:
 protected:
 	char m_cColor;					///< 'W' or 'B'
 	char m_cName;					///< 'K', 'R', 'B', or 'P'
-	bool m_bExist;					///< true or false
 	std::pair<int, int> m_pairPos;	///< x(col), y(row) (integer!)
 
 };
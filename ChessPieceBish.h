@@ -21,7 +21,7 @@ public:
 		: CChessPiece(color, name, col, row) {}
 	virtual ~CChessPieceBish() {}
 
-	virtual std::vector<std::pair<int, int>> GetPossiblePos();
+	virtual Bitboard GetTargets(const CPosition& pos);
 
 private:
 	/// non construction-copyable
@@ -0,0 +1,76 @@
+///
+/// @file		CpuFeatures.h
+/// @author		Junpyo Hong (jp7.hong@gmail.com)
+/// @date		Oct. 18, 2026
+/// @version	1.0
+/// @brief		run-time detection of optional CPU instruction sets
+/// @remark		Tab size: 4
+///
+
+#ifndef _CPU_FEATURES_H_
+#define _CPU_FEATURES_H_
+
+#if defined(_MSC_VER)
+#include <intrin.h>		// __cpuid, __cpuidex
+#endif
+
+/// x86/x64 builds may dispatch to BMI2/SSE/AVX code paths at run time
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define CHESS_X86	1
+#endif
+
+/// mark a function as compiled for an instruction set the build doesn't assume
+#if defined(CHESS_X86) && (defined(__GNUC__) || defined(__clang__))
+#define CHESS_TARGET(isa)	__attribute__((target(isa)))
+#else
+#define CHESS_TARGET(isa)
+#endif
+
+/// @brief		check whether the CPU supports BMI2 (PEXT/PDEP)
+inline bool
+CpuHasBmi2()
+{
+#if defined(CHESS_X86) && defined(_MSC_VER)
+	int arrInfo[4];
+	__cpuidex(arrInfo, 7, 0);
+	return (arrInfo[1] & (1 << 8)) != 0;
+#elif defined(CHESS_X86) && (defined(__GNUC__) || defined(__clang__))
+	return __builtin_cpu_supports("bmi2") != 0;
+#else
+	return false;
+#endif
+}
+
+/// @brief		check whether the CPU supports SSSE3 (PSHUFB)
+inline bool
+CpuHasSsse3()
+{
+#if defined(CHESS_X86) && defined(_MSC_VER)
+	int arrInfo[4];
+	__cpuid(arrInfo, 1);
+	return (arrInfo[2] & (1 << 9)) != 0;
+#elif defined(CHESS_X86) && (defined(__GNUC__) || defined(__clang__))
+	return __builtin_cpu_supports("ssse3") != 0;
+#else
+	return false;
+#endif
+}
+
+/// @brief		check whether the CPU (and the OS, for the YMM registers) supports AVX2
+inline bool
+CpuHasAvx2()
+{
+#if defined(CHESS_X86) && defined(_MSC_VER)
+	int arrInfo[4];
+	__cpuid(arrInfo, 1);
+	bool bOsAvx = (arrInfo[2] & (1 << 27)) && (arrInfo[2] & (1 << 28)) && ((_xgetbv(0) & 6) == 6);
+	__cpuidex(arrInfo, 7, 0);
+	return bOsAvx && (arrInfo[1] & (1 << 5)) != 0;
+#elif defined(CHESS_X86) && (defined(__GNUC__) || defined(__clang__))
+	return __builtin_cpu_supports("avx2") != 0;
+#else
+	return false;
+#endif
+}
+
+#endif // _CPU_FEATURES_H_
@@ -0,0 +1,101 @@
+///
+/// @file		Eval.cpp
+/// @author		Junpyo Hong (jp7.hong@gmail.com)
+/// @date		Oct. 18, 2026
+/// @version	1.0
+/// @brief		static evaluation (material and piece-square tables, kept up to date by CPosition)
+/// @remark		Tab size: 4
+///
+
+#include "Eval.h"
+
+/// material value of each piece type
+const int g_arrPieceValue[TYPE_NB] = { 0, 500, 330, 100 };
+
+/// combined material and square bonus (filled at program start-up)
+int g_arrPsq[SIDE_NB][TYPE_NB][SQUARE_NB];
+
+namespace
+{
+	/// square bonus of each piece type for white, as seen on the board (row 8 first, A to H)
+	const int s_arrSquareBonus[TYPE_NB][SQUARE_NB] =
+	{
+		// king: safety; stay on the back row beside the center, where the pawns shelter it
+		{
+			-60, -60, -60, -60, -60, -60, -60, -60,
+			-50, -50, -50, -50, -50, -50, -50, -50,
+			-40, -40, -40, -40, -40, -40, -40, -40,
+			-30, -30, -30, -40, -40, -30, -30, -30,
+			-20, -20, -30, -30, -30, -30, -20, -20,
+			-10, -10, -20, -20, -20, -20, -10, -10,
+			 10,  10,   0, -10, -10,   0,  10,  10,
+			 20,  30,  10,   0,   0,  10,  30,  20,
+		},
+		// rook: central files, and the enemy's pawn row
+		{
+			  0,   0,   0,   5,   5,   0,   0,   0,
+			 10,  20,  20,  20,  20,  20,  20,  10,
+			 -5,   0,   0,   0,   0,   0,   0,  -5,
+			 -5,   0,   0,   0,   0,   0,   0,  -5,
+			 -5,   0,   0,   0,   0,   0,   0,  -5,
+			 -5,   0,   0,   0,   0,   0,   0,  -5,
+			 -5,   0,   0,   0,   0,   0,   0,  -5,
+			  0,   0,   0,   5,   5,   0,   0,   0,
+		},
+		// bishop: long diagonals toward the center, away from the edges
+		{
+			-20, -10, -10, -10, -10, -10, -10, -20,
+			-10,   0,   0,   0,   0,   0,   0, -10,
+			-10,   0,   5,  10,  10,   5,   0, -10,
+			-10,   5,   5,  10,  10,   5,   5, -10,
+			-10,   0,  10,  10,  10,  10,   0, -10,
+			-10,  10,  10,  10,  10,  10,  10, -10,
+			-10,   5,   0,   0,   0,   0,   5, -10,
+			-20, -10, -10, -10, -10, -10, -10, -20,
+		},
+		// pawn: advancement (a pawn never promotes, so the last row only blocks)
+		{
+			  5,   5,   5,   5,   5,   5,   5,   5,
+			 40,  40,  40,  45,  45,  40,  40,  40,
+			 25,  25,  30,  35,  35,  30,  25,  25,
+			 10,  10,  15,  25,  25,  15,  10,  10,
+			  5,   5,  10,  20,  20,  10,   5,   5,
+			  0,   0,   5,   5,   5,   5,   0,   0,
+			  0,   0,   0, -10, -10,   0,   0,   0,
+			  0,   0,   0,   0,   0,   0,   0,   0,
+		},
+	};
+
+	/// @brief		fill the combined tables once at program start-up
+	struct SPsqInit
+	{
+		SPsqInit()
+		{
+			for (int type = 0; type < TYPE_NB; type++)
+			{
+				for (int sq = 0; sq < SQUARE_NB; sq++)
+				{
+					int x = SQ_X(sq);
+					int y = SQ_Y(sq);
+
+					// white reads the table upside down, black reads it as written
+					g_arrPsq[SIDE_WHITE][type][sq] = g_arrPieceValue[type] \
+						+ s_arrSquareBonus[type][SQ(x, BOARD_LEN - 1 - y)];
+					g_arrPsq[SIDE_BLACK][type][sq] = -(g_arrPieceValue[type] \
+						+ s_arrSquareBonus[type][sq]);
+				}
+			}
+		}
+	} s_psqInit;
+}
+
+/// @brief		static score for the side to move, recomputed from every piece
+/// @param		pos [in] position
+/// @return		score in centipawns (equal to Evaluate())
+/// @remark		for checking the incremental score and timing the difference
+int
+EvaluateFull(const CPosition& pos)
+{
+	int score = pos.ComputePsq();
+	return (pos.GetSide() == SIDE_WHITE) ? score : -score;
+}
@@ -0,0 +1,35 @@
+///
+/// @file		Eval.h
+/// @author		Junpyo Hong (jp7.hong@gmail.com)
+/// @date		Oct. 18, 2026
+/// @version	1.0
+/// @brief		static evaluation (material and piece-square tables, kept up to date by CPosition)
+/// @remark		Tab size: 4
+///
+
+#ifndef _EVAL_H_
+#define _EVAL_H_
+
+#include "Position.h"
+
+/// material value of each piece type (the king is never traded, see SCORE_WIN in Search.h)
+extern const int g_arrPieceValue[TYPE_NB];
+
+/// score of a piece on a square from white's point of view (material plus the square bonus,
+/// negative for black pieces), so a position scores the sum over its pieces
+extern int g_arrPsq[SIDE_NB][TYPE_NB][SQUARE_NB];
+
+/// @brief		static score for the side to move
+/// @param		pos [in] position
+/// @return		score in centipawns
+/// @remark		a few adds per move: the sum is kept by CPosition::PutPiece(), RemovePiece(),
+///				and MovePiece() (see CPosition::ComputePsq() for the full recomputation)
+inline int
+Evaluate(const CPosition& pos)
+{
+	return (pos.GetSide() == SIDE_WHITE) ? pos.GetPsq() : -pos.GetPsq();
+}
+
+int EvaluateFull(const CPosition& pos);
+
+#endif // _EVAL_H_
@@ -0,0 +1,333 @@
+///
+/// @file		EvalBatch.cpp
+/// @author		Junpyo Hong (jp7.hong@gmail.com)
+/// @date		Oct. 18, 2026
+/// @version	1.0
+/// @brief		batch evaluation of many independent positions (AVX2, SSSE3, or scalar)
+/// @remark		Tab size: 4
+///
+
+#include <cassert>		// assert
+
+#include "EvalBatch.h"
+#include "Eval.h"
+#include "CpuFeatures.h"
+
+#if defined(CHESS_X86)
+#include <immintrin.h>	// SSSE3 and AVX2 intrinsics
+#endif
+
+namespace
+{
+	/// number of piece codes of SPositionBatch::vSquare (vacant, then each side and type)
+	const int CODE_NB = 1 + SIDE_NB * TYPE_NB;
+
+	/// @brief		tables of the vector paths (built from g_arrPsq on first use)
+	struct SBatchTables
+	{
+		/// square bonus (g_arrPsq without the material) of each piece code, 16 bytes for
+		/// PSHUFB, repeated in both 128-bit lanes for AVX2
+		alignas(32) int8_t arrBonus[SQUARE_NB][32];
+
+		/// material of each side and type, negative for black
+		int arrMaterial[SIDE_NB][TYPE_NB];
+
+		SBatchTables()
+		{
+			for (int side = 0; side < SIDE_NB; side++)
+				for (int type = 0; type < TYPE_NB; type++)
+					arrMaterial[side][type] = (side == SIDE_WHITE) ? g_arrPieceValue[type] : -g_arrPieceValue[type];
+
+			for (int sq = 0; sq < SQUARE_NB; sq++)
+			{
+				for (int i = 0; i < 32; i++)
+				{
+					int code = i & 15;
+					int bonus = 0;
+
+					if (code > 0 && code < CODE_NB)
+					{
+						int side = (code - 1) / TYPE_NB;
+						int type = (code - 1) % TYPE_NB;
+						bonus = g_arrPsq[side][type][sq] - arrMaterial[side][type];
+					}
+
+					// two bonuses are added in bytes before they are widened
+					assert(bonus > -64 && bonus < 64);
+					arrBonus[sq][i] = int8_t(bonus);
+				}
+			}
+		}
+	};
+
+	/// @brief		the tables (g_arrPsq is filled during static initialization, so not before)
+	const SBatchTables&
+	GetTables()
+	{
+		static const SBatchTables s_tables;
+		return s_tables;
+	}
+
+	/// @brief		evaluate positions one at a time from their bitboards
+	/// @param		batch [in] positions
+	/// @param		pScores [out] score of each position for its side to move
+	/// @param		nBegin [in] first position
+	/// @return		void
+	void
+	EvaluateScalar(const SPositionBatch& batch, int *pScores, const int nBegin)
+	{
+		for (int i = nBegin; i < batch.Size(); i++)
+		{
+			int score = 0;
+
+			for (int side = 0; side < SIDE_NB; side++)
+			{
+				for (int type = 0; type < TYPE_NB; type++)
+				{
+					for (Bitboard bb = batch.vPieces[side][type][i]; bb; )
+						score += g_arrPsq[side][type][PopLsb(bb)];
+				}
+			}
+
+			pScores[i] = (batch.vSide[i] == SIDE_WHITE) ? score : -score;
+		}
+	}
+
+#if defined(CHESS_X86)
+
+	/// @brief		popcount of each 64-bit lane (nibble lookup with PSHUFB, then PSADBW)
+	CHESS_TARGET("ssse3") inline __m128i
+	PopCount2(const __m128i v)
+	{
+		const __m128i vLut = _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+		const __m128i vNibble = _mm_set1_epi8(0x0F);
+
+		__m128i vCnt = _mm_add_epi8(_mm_shuffle_epi8(vLut, _mm_and_si128(v, vNibble)), \
+			_mm_shuffle_epi8(vLut, _mm_and_si128(_mm_srli_epi16(v, 4), vNibble)));
+		return _mm_sad_epu8(vCnt, _mm_setzero_si128());
+	}
+
+	/// @brief		evaluate 16 positions at a time with SSSE3
+	/// @param		batch [in] positions
+	/// @param		pScores [out] score of each position for its side to move
+	/// @return		the number of positions evaluated (a multiple of 16)
+	CHESS_TARGET("ssse3") int
+	EvaluateSsse3(const SPositionBatch& batch, int *pScores)
+	{
+		const SBatchTables& tables = GetTables();
+		const int nEnd = batch.Size() & ~15;
+
+		for (int i = 0; i < nEnd; i += 16)
+		{
+			// square bonus: one shuffle per square, two squares added in bytes, then widened
+			__m128i vLo = _mm_setzero_si128();
+			__m128i vHi = _mm_setzero_si128();
+			for (int sq = 0; sq < SQUARE_NB; sq += 2)
+			{
+				__m128i v0 = _mm_shuffle_epi8(_mm_load_si128((const __m128i*)tables.arrBonus[sq]), \
+					_mm_loadu_si128((const __m128i*)&batch.vSquare[sq][i]));
+				__m128i v1 = _mm_shuffle_epi8(_mm_load_si128((const __m128i*)tables.arrBonus[sq + 1]), \
+					_mm_loadu_si128((const __m128i*)&batch.vSquare[sq + 1][i]));
+				__m128i v = _mm_add_epi8(v0, v1);
+				__m128i vSign = _mm_cmpgt_epi8(_mm_setzero_si128(), v);
+				vLo = _mm_add_epi16(vLo, _mm_unpacklo_epi8(v, vSign));
+				vHi = _mm_add_epi16(vHi, _mm_unpackhi_epi8(v, vSign));
+			}
+
+			alignas(16) int16_t arrBonus[16];
+			_mm_store_si128((__m128i*)&arrBonus[0], vLo);
+			_mm_store_si128((__m128i*)&arrBonus[8], vHi);
+
+			// material: popcount of two positions at a time, times the value of the piece
+			for (int j = 0; j < 16; j += 2)
+			{
+				__m128i vMaterial = _mm_setzero_si128();
+				for (int side = 0; side < SIDE_NB; side++)
+				{
+					for (int type = TYPE_ROOK; type < TYPE_NB; type++)
+					{
+						__m128i vCnt = PopCount2(_mm_loadu_si128((const __m128i*)&batch.vPieces[side][type][i + j]));
+						__m128i vValue = _mm_set1_epi64x(uint16_t(tables.arrMaterial[side][type]));
+						vMaterial = _mm_add_epi32(vMaterial, _mm_madd_epi16(vCnt, vValue));
+					}
+				}
+
+				alignas(16) int32_t arrMaterial[4];
+				_mm_store_si128((__m128i*)arrMaterial, vMaterial);
+
+				for (int k = 0; k < 2; k++)
+				{
+					int score = arrMaterial[2 * k] + arrBonus[j + k];
+					pScores[i + j + k] = (batch.vSide[i + j + k] == SIDE_WHITE) ? score : -score;
+				}
+			}
+		}
+
+		return nEnd;
+	}
+
+	/// @brief		popcount of each 64-bit lane (nibble lookup with VPSHUFB, then VPSADBW)
+	CHESS_TARGET("avx2") inline __m256i
+	PopCount4(const __m256i v)
+	{
+		const __m256i vLut = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, \
+			0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+		const __m256i vNibble = _mm256_set1_epi8(0x0F);
+
+		__m256i vCnt = _mm256_add_epi8(_mm256_shuffle_epi8(vLut, _mm256_and_si256(v, vNibble)), \
+			_mm256_shuffle_epi8(vLut, _mm256_and_si256(_mm256_srli_epi16(v, 4), vNibble)));
+		return _mm256_sad_epu8(vCnt, _mm256_setzero_si256());
+	}
+
+	/// @brief		evaluate 32 positions at a time with AVX2
+	/// @param		batch [in] positions
+	/// @param		pScores [out] score of each position for its side to move
+	/// @return		the number of positions evaluated (a multiple of 32)
+	CHESS_TARGET("avx2") int
+	EvaluateAvx2(const SPositionBatch& batch, int *pScores)
+	{
+		const SBatchTables& tables = GetTables();
+		const int nEnd = batch.Size() & ~31;
+
+		for (int i = 0; i < nEnd; i += 32)
+		{
+			// square bonus: one shuffle per square, two squares added in bytes, then widened
+			__m256i vLo = _mm256_setzero_si256();
+			__m256i vHi = _mm256_setzero_si256();
+			for (int sq = 0; sq < SQUARE_NB; sq += 2)
+			{
+				__m256i v0 = _mm256_shuffle_epi8(_mm256_load_si256((const __m256i*)tables.arrBonus[sq]), \
+					_mm256_loadu_si256((const __m256i*)&batch.vSquare[sq][i]));
+				__m256i v1 = _mm256_shuffle_epi8(_mm256_load_si256((const __m256i*)tables.arrBonus[sq + 1]), \
+					_mm256_loadu_si256((const __m256i*)&batch.vSquare[sq + 1][i]));
+				__m256i v = _mm256_add_epi8(v0, v1);
+				__m256i vSign = _mm256_cmpgt_epi8(_mm256_setzero_si256(), v);
+				vLo = _mm256_add_epi16(vLo, _mm256_unpacklo_epi8(v, vSign));
+				vHi = _mm256_add_epi16(vHi, _mm256_unpackhi_epi8(v, vSign));
+			}
+
+			// the unpacks work within 128-bit lanes: put the positions back in order
+			alignas(32) int16_t arrBonus[32];
+			_mm256_store_si256((__m256i*)&arrBonus[0], _mm256_permute2x128_si256(vLo, vHi, 0x20));
+			_mm256_store_si256((__m256i*)&arrBonus[16], _mm256_permute2x128_si256(vLo, vHi, 0x31));
+
+			// material: popcount of four positions at a time, times the value of the piece
+			for (int j = 0; j < 32; j += 4)
+			{
+				__m256i vMaterial = _mm256_setzero_si256();
+				for (int side = 0; side < SIDE_NB; side++)
+				{
+					for (int type = TYPE_ROOK; type < TYPE_NB; type++)
+					{
+						__m256i vCnt = PopCount4(_mm256_loadu_si256((const __m256i*)&batch.vPieces[side][type][i + j]));
+						__m256i vValue = _mm256_set1_epi64x(uint16_t(tables.arrMaterial[side][type]));
+						vMaterial = _mm256_add_epi32(vMaterial, _mm256_madd_epi16(vCnt, vValue));
+					}
+				}
+
+				alignas(32) int32_t arrMaterial[8];
+				_mm256_store_si256((__m256i*)arrMaterial, vMaterial);
+
+				for (int k = 0; k < 4; k++)
+				{
+					int score = arrMaterial[2 * k] + arrBonus[j + k];
+					pScores[i + j + k] = (batch.vSide[i + j + k] == SIDE_WHITE) ? score : -score;
+				}
+			}
+		}
+
+		return nEnd;
+	}
+
+#endif // CHESS_X86
+}
+
+/// @brief		remove all positions
+/// @param		N/A
+/// @return		void
+void
+SPositionBatch::Clear()
+{
+	for (int side = 0; side < SIDE_NB; side++)
+		for (int type = 0; type < TYPE_NB; type++)
+			vPieces[side][type].clear();
+
+	for (int sq = 0; sq < SQUARE_NB; sq++)
+		vSquare[sq].clear();
+
+	vSide.clear();
+}
+
+/// @brief		append a position
+/// @param		pos [in] position
+/// @return		void
+void
+SPositionBatch::Add(const CPosition& pos)
+{
+	for (int side = 0; side < SIDE_NB; side++)
+		for (int type = 0; type < TYPE_NB; type++)
+			vPieces[side][type].push_back(pos.GetPieces(side, type));
+
+	for (int sq = 0; sq < SQUARE_NB; sq++)
+		vSquare[sq].push_back(0);
+
+	for (int idx = 0; idx < pos.GetPieceCount(); idx++)
+		vSquare[pos.GetPieceSq(idx)].back() = uint8_t(1 + pos.GetPieceSide(idx) * TYPE_NB + pos.GetPieceType(idx));
+
+	vSide.push_back(uint8_t(pos.GetSide()));
+}
+
+/// @brief		check whether the CPU runs an instruction set of EvaluateBatch()
+/// @param		isa [in] BATCH_SCALAR, BATCH_SSSE3, or BATCH_AVX2
+/// @return		true if supported, otherwise false
+bool
+IsBatchIsaSupported(const int isa)
+{
+	switch (isa)
+	{
+	case BATCH_SCALAR:	return true;
+	case BATCH_SSSE3:	return CpuHasSsse3();
+	case BATCH_AVX2:	return CpuHasAvx2();
+	default:			return false;
+	}
+}
+
+/// @brief		name of an instruction set of EvaluateBatch()
+/// @param		isa [in] BATCH_SCALAR, BATCH_SSSE3, or BATCH_AVX2
+/// @return		"scalar", "ssse3", or "avx2"
+const char*
+GetBatchIsaName(const int isa)
+{
+	switch (isa)
+	{
+	case BATCH_SSSE3:	return "ssse3";
+	case BATCH_AVX2:	return "avx2";
+	default:			return "scalar";
+	}
+}
+
+/// @brief		evaluate many independent positions (the scores of EvaluateFull())
+/// @param		batch [in] positions
+/// @param		pScores [out] score of each position for its side to move (batch.Size() entries)
+/// @param		isa [in] instruction set (BATCH_BEST for the best one the CPU runs)
+/// @return		void
+/// @remark		an instruction set the CPU lacks falls back to the next one below it.
+///				the positions after the last full vector are evaluated by the scalar path.
+void
+EvaluateBatch(const SPositionBatch& batch, int *pScores, const int isa)
+{
+	int nIsa = (isa == BATCH_BEST) ? BATCH_ISA_NB - 1 : isa;
+	while (!IsBatchIsaSupported(nIsa))
+		nIsa--;
+
+	int nDone = 0;
+
+#if defined(CHESS_X86)
+	if (nIsa == BATCH_AVX2)
+		nDone = EvaluateAvx2(batch, pScores);
+	else if (nIsa == BATCH_SSSE3)
+		nDone = EvaluateSsse3(batch, pScores);
+#endif
+
+	EvaluateScalar(batch, pScores, nDone);
+}
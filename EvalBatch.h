@@ -0,0 +1,39 @@
+///
+/// @file		EvalBatch.h
+/// @author		Junpyo Hong (jp7.hong@gmail.com)
+/// @date		Oct. 18, 2026
+/// @version	1.0
+/// @brief		batch evaluation of many independent positions (AVX2, SSSE3, or scalar)
+/// @remark		Tab size: 4
+///
+
+#ifndef _EVAL_BATCH_H_
+#define _EVAL_BATCH_H_
+
+#include <vector>		// std::vector
+
+#include "Position.h"
+
+/// instruction set of EvaluateBatch()
+enum EBatchIsa { BATCH_SCALAR = 0, BATCH_SSSE3, BATCH_AVX2, BATCH_ISA_NB, BATCH_BEST = BATCH_ISA_NB };
+
+/// @brief		positions in a structure-of-arrays layout (each array has one entry per position)
+/// @remark		the bitboards (W/B and K/R/B/P as in CChessPiece) give the material by popcount,
+///				and the piece code of each square, 1 + side * TYPE_NB + type (0 if vacant),
+///				indexes the square bonus with one byte shuffle for 16 or 32 positions
+struct SPositionBatch
+{
+	std::vector<Bitboard> vPieces[SIDE_NB][TYPE_NB];	///< pieces of each side and type
+	std::vector<uint8_t> vSquare[SQUARE_NB];			///< piece code on each square
+	std::vector<uint8_t> vSide;							///< side to move
+
+	void Clear();
+	void Add(const CPosition& pos);
+	int Size() const { return int(vSide.size()); }
+};
+
+bool IsBatchIsaSupported(const int isa);
+const char* GetBatchIsaName(const int isa);
+void EvaluateBatch(const SPositionBatch& batch, int *pScores, const int isa = BATCH_BEST);
+
+#endif // _EVAL_BATCH_H_
@@ -0,0 +1,151 @@
+///
+/// @file		GameArchive.cpp
+/// @author		Junpyo Hong (jp7.hong@gmail.com)
+/// @date		Oct. 18, 2026
+/// @version	1.0
+/// @brief		binary game archive (header, game index, and 2 bytes per move)
+/// @remark		Tab size: 4
+///
+
+#include <cstdio>		// fopen, fwrite, fclose
+#include <cstring>		// memcmp, memcpy, memchr
+#include <iostream>		// std::cerr
+#include <vector>		// std::vector
+
+#include "GameArchive.h"
+#include "Move.h"
+
+namespace
+{
+	/// magic at the start of an archive
+	const char s_szMagic[4] = { 'C', 'G', 'A', '1' };
+}
+
+/// @brief		check whether data starts with an archive header
+/// @param		pData [in] first byte of the data
+/// @param		nSize [in] size of the data in bytes
+/// @return		true if the data looks like an archive, otherwise false
+bool
+CGameArchive::IsArchive(const char *pData, const size_t nSize)
+{
+	return nSize >= sizeof(SGameArchiveHeader) && memcmp(pData, s_szMagic, sizeof(s_szMagic)) == 0;
+}
+
+/// @brief		map an archive file
+/// @param		szPath [in] path of the archive
+/// @return		true if the file is a valid archive, otherwise false
+bool
+CGameArchive::Open(const char *szPath)
+{
+	return m_file.Open(szPath) && Attach(m_file.GetData(), m_file.GetSize());
+}
+
+/// @brief		view archive data which is kept alive by the caller
+/// @param		pData [in] first byte of the archive (8-byte aligned)
+/// @param		nSize [in] size of the archive in bytes
+/// @return		true if the data is a valid archive, otherwise false
+bool
+CGameArchive::Attach(const char *pData, const size_t nSize)
+{
+	m_pIndex = 0;
+	m_pMoves = 0;
+	m_nGames = 0;
+
+	if (!IsArchive(pData, nSize))
+		return false;
+
+	SGameArchiveHeader header;
+	memcpy(&header, pData, sizeof(header));
+	if (header.nVersion != GAME_ARCHIVE_VERSION)
+		return false;
+
+	// the index and the moves must fit in the data
+	size_t nIndexBytes = size_t(header.nGames + 1) * sizeof(uint64_t);
+	if (header.nGames >= (nSize - sizeof(header)) / sizeof(uint64_t))
+		return false;
+
+	const uint64_t *pIndex = reinterpret_cast<const uint64_t*>(pData + sizeof(header));
+	size_t nMoveBytes = nSize - sizeof(header) - nIndexBytes;
+	if (pIndex[0] != 0 || pIndex[header.nGames] > nMoveBytes / sizeof(uint16_t))
+		return false;
+
+	// a decreasing entry would give GetMoves() a huge count (past the end of the data)
+	for (uint64_t i = 0; i < header.nGames; i++)
+	{
+		if (pIndex[i] > pIndex[i + 1])
+			return false;
+	}
+
+	m_pIndex = pIndex;
+	m_pMoves = reinterpret_cast<const uint16_t*>(pData + sizeof(header) + nIndexBytes);
+	m_nGames = header.nGames;
+
+	return true;
+}
+
+/// @brief		convert recorded games (one game per line, see RunReplay()) to an archive
+/// @param		szTextPath [in] path of the games ("-" for the standard input)
+/// @param		szArchivePath [in] path of the archive to write
+/// @return		true on success, otherwise false
+/// @remark		a malformed move is stored as ARCHIVE_MOVE_BAD and ends its game, so
+///				replaying the archive gives the same results as replaying the text
+bool
+ConvertGameText(const char *szTextPath, const char *szArchivePath)
+{
+	CMappedFile file;
+	if (!file.Open(szTextPath))
+	{
+		std::cerr << "cannot read " << szTextPath << std::endl;
+		return false;
+	}
+
+	std::vector<uint64_t> vIndex;
+	std::vector<uint16_t> vMoves;
+	vIndex.reserve(file.GetSize() / 512 + 1);
+	vMoves.reserve(file.GetSize() / 6 + 1);
+
+	const char *p = file.GetData();
+	const char *pEnd = p + file.GetSize();
+	while (p < pEnd)
+	{
+		const char *pEol = static_cast<const char*>(memchr(p, '\n', size_t(pEnd - p)));
+		if (!pEol)
+			pEol = pEnd;
+
+		vIndex.push_back(uint64_t(vMoves.size()));
+
+		int from, to, nRet;
+		while ((nRet = ParseMoveToken(p, pEol, from, to)) > 0)
+			vMoves.push_back(uint16_t(PackMove(from, to, MOVE_QUIET)));
+		if (nRet < 0)
+			vMoves.push_back(ARCHIVE_MOVE_BAD);
+
+		p = pEol + 1;
+	}
+
+	SGameArchiveHeader header;
+	memcpy(header.szMagic, s_szMagic, sizeof(s_szMagic));
+	header.nVersion = GAME_ARCHIVE_VERSION;
+	header.nGames = uint64_t(vIndex.size());
+	vIndex.push_back(uint64_t(vMoves.size()));
+
+	FILE *fp = fopen(szArchivePath, "wb");
+	if (!fp)
+	{
+		std::cerr << "cannot write " << szArchivePath << std::endl;
+		return false;
+	}
+
+	bool bRet = fwrite(&header, sizeof(header), 1, fp) == 1 \
+		&& fwrite(&vIndex[0], sizeof(uint64_t), vIndex.size(), fp) == vIndex.size() \
+		&& (vMoves.empty() || fwrite(&vMoves[0], sizeof(uint16_t), vMoves.size(), fp) == vMoves.size());
+	bRet = (fclose(fp) == 0) && bRet;
+
+	if (!bRet)
+		std::cerr << "cannot write " << szArchivePath << std::endl;
+	else
+		std::cerr << "games " << header.nGames << " moves " << vMoves.size() << " bytes " \
+			<< sizeof(header) + vIndex.size() * sizeof(uint64_t) + vMoves.size() * sizeof(uint16_t) << std::endl;
+
+	return bRet;
+}
@@ -0,0 +1,73 @@
+///
+/// @file		GameArchive.h
+/// @author		Junpyo Hong (jp7.hong@gmail.com)
+/// @date		Oct. 18, 2026
+/// @version	1.0
+/// @brief		binary game archive (header, game index, and 2 bytes per move)
+/// @remark		Tab size: 4
+///
+
+#ifndef _GAME_ARCHIVE_H_
+#define _GAME_ARCHIVE_H_
+
+#include <cstdint>		// uint16_t, uint32_t, uint64_t
+#include <cstddef>		// size_t
+
+#include "MappedFile.h"
+
+/// layout of an archive (little-endian, every part aligned to its own size):
+///   SGameArchiveHeader
+///   uint64_t index[nGames + 1]	first move of each game, then the total number of moves
+///   uint16_t moves[]				from | to << 6 (the Move encoding without flags)
+
+/// version of the archive layout
+const uint32_t GAME_ARCHIVE_VERSION = 1;
+
+/// move record of a token which is not a well-formed move (the rest of its game is dropped)
+const uint16_t ARCHIVE_MOVE_BAD = 0xFFFF;
+
+/// @brief		header at the start of an archive
+struct SGameArchiveHeader
+{
+	char szMagic[4];			///< "CGA1"
+	uint32_t nVersion;			///< GAME_ARCHIVE_VERSION
+	uint64_t nGames;			///< the number of games
+};
+
+/// @brief		zero-copy view of a game archive
+class CGameArchive
+{
+public:
+	explicit CGameArchive() : m_pIndex(0), m_pMoves(0), m_nGames(0) {}
+
+	static bool IsArchive(const char *pData, const size_t nSize);
+
+	bool Open(const char *szPath);
+	bool Attach(const char *pData, const size_t nSize);
+
+	uint64_t GetGames() const { return m_nGames; }
+
+	/// @brief		moves of a game (points into the archive, nothing is copied)
+	const uint16_t* GetMoves(const uint64_t nGame, uint32_t& nMoves) const
+	{
+		nMoves = uint32_t(m_pIndex[nGame + 1] - m_pIndex[nGame]);
+		return m_pMoves + m_pIndex[nGame];
+	}
+
+private:
+	/// non construction-copyable
+	CGameArchive(const CGameArchive&);
+
+	/// non copyable
+	const CGameArchive& operator=(const CGameArchive&);
+
+private:
+	CMappedFile m_file;					///< file opened by Open() (unused by Attach())
+	const uint64_t *m_pIndex;			///< first move of each game (nGames + 1 entries)
+	const uint16_t *m_pMoves;			///< moves of every game
+	uint64_t m_nGames;					///< the number of games
+};
+
+bool ConvertGameText(const char *szTextPath, const char *szArchivePath);
+
+#endif // _GAME_ARCHIVE_H_
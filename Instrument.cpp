@@ -0,0 +1,186 @@
+///
+/// @file		Instrument.cpp
+/// @author		Junpyo Hong (jp7.hong@gmail.com)
+/// @date		Oct. 18, 2026
+/// @version	1.0
+/// @brief		hot-path call and cycle counters (compiled in only with CHESS_INSTRUMENT)
+/// @remark		Tab size: 4
+///
+
+#include "Instrument.h"
+
+#if defined(CHESS_INSTRUMENT)
+
+#include <cstdlib>		// atexit
+#include <csignal>		// signal, SIGUSR1
+#include <cstring>		// strlen
+
+#if defined(_WIN32)
+#include <io.h>			// _write
+#else
+#include <unistd.h>		// write
+#endif
+
+namespace
+{
+	/// counter blocks, zeroed as static storage (no allocation on the hot path)
+	SCounterBlock s_arrBlocks[COUNTER_BLOCK_MAX];
+
+	/// the number of blocks handed out (only grows, so a signal handler can walk the pool)
+	std::atomic<int> s_nBlocks(0);
+
+	/// name of each counter in the report
+	const char *s_arrCounterNames[CNT_NB] =
+	{
+		"targets.king",
+		"targets.rook",
+		"targets.bish",
+		"targets.pawn",
+		"generatemoves",
+		"update",
+		"isincheck",
+		"decision",
+		"input",
+		"output",
+	};
+
+	/// report buffer (static, so that the report needs no allocation inside a signal handler)
+	char s_szReport[4096];
+
+	/// @brief		append text padded to a width (left aligned if nWidth < 0)
+	int
+	AppendText(char *sz, int n, const char *szText, const int nWidth)
+	{
+		int nLen = int(strlen(szText));
+		int nPad = (nWidth < 0 ? -nWidth : nWidth) - nLen;
+
+		if (nWidth > 0)
+			for (; nPad > 0; nPad--)
+				sz[n++] = ' ';
+		for (int i = 0; i < nLen; i++)
+			sz[n++] = szText[i];
+		for (; nPad > 0; nPad--)
+			sz[n++] = ' ';
+
+		return n;
+	}
+
+	/// @brief		append an unsigned number right aligned to a width
+	int
+	AppendNumber(char *sz, int n, uint64_t v, const int nWidth)
+	{
+		char szDigits[24];
+		int nDigits = sizeof(szDigits) - 1;
+
+		szDigits[nDigits] = '\0';
+		do
+		{
+			szDigits[--nDigits] = char('0' + v % 10);
+			v /= 10;
+		} while (v > 0);
+
+		return AppendText(sz, n, szDigits + nDigits, nWidth);
+	}
+
+	/// @brief		write the report when the program exits
+	void
+	OnExit()
+	{
+		WriteInstrumentReport();
+	}
+
+#if defined(SIGUSR1)
+	/// @brief		write the report on SIGUSR1 (only async-signal-safe calls are made)
+	void
+	OnSignal(int)
+	{
+		WriteInstrumentReport();
+	}
+#endif
+}
+
+/// @brief		take the counter block of the calling thread from the static pool
+/// @param		N/A
+/// @return		zeroed counter block (never reused, so the report includes finished threads)
+/// @remark		once the pool is used up, later threads share its last block and may lose
+///				some counts to each other
+SCounterBlock*
+RegisterCounterBlock()
+{
+	int idx = s_nBlocks.fetch_add(1, std::memory_order_relaxed);
+	if (idx >= COUNTER_BLOCK_MAX)
+		idx = COUNTER_BLOCK_MAX - 1;
+
+	return &s_arrBlocks[idx];
+}
+
+/// @brief		write the report at exit and on SIGUSR1 (where available)
+/// @param		N/A
+/// @return		void
+void
+InstallInstrumentReport()
+{
+	atexit(OnExit);
+#if defined(SIGUSR1)
+	signal(SIGUSR1, OnSignal);
+#endif
+}
+
+/// @brief		write the counters of every thread, merged, to stderr
+/// @param		N/A
+/// @return		void
+/// @remark		threads may still be counting; each figure is read once, without locks
+void
+WriteInstrumentReport()
+{
+	uint64_t arrCalls[CNT_NB] = { 0 };
+	uint64_t arrTicks[CNT_NB] = { 0 };
+	uint64_t nThreads = 0;
+
+	int nBlocks = s_nBlocks.load(std::memory_order_relaxed);
+	if (nBlocks > COUNTER_BLOCK_MAX)
+		nBlocks = COUNTER_BLOCK_MAX;
+
+	for (int b = 0; b < nBlocks; b++)
+	{
+		for (int i = 0; i < CNT_NB; i++)
+		{
+			arrCalls[i] += s_arrBlocks[b].arrCalls[i].load(std::memory_order_relaxed);
+			arrTicks[i] += s_arrBlocks[b].arrTicks[i].load(std::memory_order_relaxed);
+		}
+		nThreads++;
+	}
+
+	int n = 0;
+	char *sz = s_szReport;
+
+	n = AppendText(sz, n, "instrumentation (threads ", 0);
+	n = AppendNumber(sz, n, nThreads, 0);
+#if defined(CHESS_X86)
+	n = AppendText(sz, n, ", cycles)\n", 0);
+#else
+	n = AppendText(sz, n, ", nanoseconds)\n", 0);
+#endif
+	n = AppendText(sz, n, "counter                  calls           ticks  ticks/call\n", 0);
+
+	for (int i = 0; i < CNT_NB; i++)
+	{
+		if (arrCalls[i] == 0)
+			continue;
+
+		n = AppendText(sz, n, s_arrCounterNames[i], -16);
+		n = AppendNumber(sz, n, arrCalls[i], 12);
+		n = AppendNumber(sz, n, arrTicks[i], 16);
+		n = AppendNumber(sz, n, arrTicks[i] / arrCalls[i], 12);
+		sz[n++] = '\n';
+	}
+
+#if defined(_WIN32)
+	_write(2, sz, unsigned(n));
+#else
+	ssize_t nWritten = write(2, sz, size_t(n));
+	(void)nWritten;
+#endif
+}
+
+#endif // CHESS_INSTRUMENT
@@ -0,0 +1,131 @@
+///
+/// @file		Instrument.h
+/// @author		Junpyo Hong (jp7.hong@gmail.com)
+/// @date		Oct. 18, 2026
+/// @version	1.0
+/// @brief		hot-path call and cycle counters (compiled in only with CHESS_INSTRUMENT)
+/// @remark		Tab size: 4
+///
+
+#ifndef _INSTRUMENT_H_
+#define _INSTRUMENT_H_
+
+#include <cstdint>		// uint64_t
+
+/// instrumented code paths
+enum ECounter
+{
+	CNT_TARGETS_KING = 0,		///< GetPieceTargets<TYPE_KING, Side>() (in EPieceType order)
+	CNT_TARGETS_ROOK,			///< GetPieceTargets<TYPE_ROOK, Side>()
+	CNT_TARGETS_BISH,			///< GetPieceTargets<TYPE_BISH, Side>()
+	CNT_TARGETS_PAWN,			///< GetPieceTargets<TYPE_PAWN, Side>() and each pawn of GenerateMoves()
+	CNT_GENERATE_MOVES,			///< GenerateMoves() and GenerateLegalMoves()
+	CNT_UPDATE,					///< CChessBoard::Update()
+	CNT_IS_IN_CHECK,			///< CChessBoard::IsInCheck()
+	CNT_DECISION,				///< CChessBoard::Decide() (MakeDecision() and replay)
+	CNT_INPUT,					///< move text parsing (GetInput() and replay)
+	CNT_OUTPUT,					///< rendering (ShowOutput() and replay result lines)
+	CNT_NB
+};
+
+#if defined(CHESS_INSTRUMENT)
+
+#include <atomic>		// std::atomic
+
+#include "CpuFeatures.h"
+
+#if defined(CHESS_X86) && defined(_MSC_VER)
+#include <intrin.h>		// __rdtsc
+#elif defined(CHESS_X86)
+#include <x86intrin.h>	// __rdtsc
+#else
+#include <chrono>		// std::chrono::steady_clock
+#endif
+
+#if defined(_MSC_VER)
+#define CHESS_THREAD_LOCAL	__declspec(thread)
+#else
+#define CHESS_THREAD_LOCAL	thread_local
+#endif
+
+/// @brief		counters of one thread (written by that thread only, so nothing is contended)
+struct SCounterBlock
+{
+	std::atomic<uint64_t> arrCalls[CNT_NB];		///< the number of calls
+	std::atomic<uint64_t> arrTicks[CNT_NB];		///< accumulated cycles (nanoseconds without TSC)
+};
+
+/// counter blocks of the static pool (threads beyond it share the last block)
+const int COUNTER_BLOCK_MAX = 256;
+
+SCounterBlock* RegisterCounterBlock();
+void InstallInstrumentReport();
+void WriteInstrumentReport();
+
+/// @brief		counters of the calling thread (taken from the static pool on first use)
+inline SCounterBlock*
+GetCounterBlock()
+{
+	static CHESS_THREAD_LOCAL SCounterBlock *t_pBlock = 0;
+	if (!t_pBlock)
+		t_pBlock = RegisterCounterBlock();
+	return t_pBlock;
+}
+
+/// @brief		time stamp counter (or a steady clock in nanoseconds)
+inline uint64_t
+ReadTicks()
+{
+#if defined(CHESS_X86)
+	return uint64_t(__rdtsc());
+#else
+	return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>( \
+		std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+/// @brief		count a call and its cycles from construction to destruction
+class CInstrumentScope
+{
+public:
+	explicit CInstrumentScope(const int nCounter) : m_nCounter(nCounter), m_nBegin(ReadTicks()) {}
+	~CInstrumentScope()
+	{
+		uint64_t nTicks = ReadTicks() - m_nBegin;
+		SCounterBlock *p = GetCounterBlock();
+
+		// single writer: a plain load and store, no read-modify-write
+		p->arrCalls[m_nCounter].store(p->arrCalls[m_nCounter].load(std::memory_order_relaxed) + 1, \
+			std::memory_order_relaxed);
+		p->arrTicks[m_nCounter].store(p->arrTicks[m_nCounter].load(std::memory_order_relaxed) + nTicks, \
+			std::memory_order_relaxed);
+	}
+
+private:
+	/// non construction-copyable
+	CInstrumentScope(const CInstrumentScope&);
+
+	/// non copyable
+	const CInstrumentScope& operator=(const CInstrumentScope&);
+
+private:
+	int m_nCounter;			///< ECounter
+	uint64_t m_nBegin;		///< ticks at construction
+};
+
+#define INSTRUMENT_CONCAT2(a, b)	a##b
+#define INSTRUMENT_CONCAT(a, b)		INSTRUMENT_CONCAT2(a, b)
+
+/// count the rest of the enclosing scope under a counter
+#define INSTRUMENT_SCOPE(nCounter)	CInstrumentScope INSTRUMENT_CONCAT(instrumentScope, __LINE__)(nCounter)
+
+#else
+
+#define INSTRUMENT_SCOPE(nCounter)	((void)0)
+
+/// @brief		nothing to report without CHESS_INSTRUMENT
+inline void InstallInstrumentReport() {}
+
+#endif // CHESS_INSTRUMENT
+
+#endif // _INSTRUMENT_H_
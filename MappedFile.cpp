@@ -0,0 +1,118 @@
+///
+/// @file		MappedFile.cpp
+/// @author		Junpyo Hong (jp7.hong@gmail.com)
+/// @date		Oct. 18, 2026
+/// @version	1.0
+/// @brief		read-only view of a whole file (memory-mapped when possible)
+/// @remark		Tab size: 4
+///
+
+#include <cstdio>		// fopen, fread, fclose
+#include <cstring>		// strcmp
+
+#if !defined(_WIN32)
+#include <sys/mman.h>	// mmap, munmap, madvise
+#include <sys/stat.h>	// fstat
+#include <fcntl.h>		// open
+#include <unistd.h>		// close
+#endif
+
+#include "MappedFile.h"
+
+namespace
+{
+	/// size of each read when the input can't be mapped
+	const size_t READ_CHUNK = 1 << 20;
+
+	/// @brief		read a stream to its end
+	bool
+	ReadAll(FILE *fp, std::vector<char>& vBuffer)
+	{
+		size_t nSize = 0;
+
+		for (;;)
+		{
+			vBuffer.resize(nSize + READ_CHUNK);
+			size_t n = fread(&vBuffer[nSize], 1, READ_CHUNK, fp);
+			nSize += n;
+			if (n < READ_CHUNK)
+				break;
+		}
+
+		vBuffer.resize(nSize);
+		return ferror(fp) == 0;
+	}
+}
+
+/// @brief		open a file for reading
+/// @param		szPath [in] path of the file ("-" for the standard input)
+/// @return		true on success, otherwise false
+bool
+CMappedFile::Open(const char *szPath)
+{
+	Close();
+
+	if (strcmp(szPath, "-") == 0)
+	{
+		if (!ReadAll(stdin, m_vBuffer))
+			return false;
+		m_pData = m_vBuffer.empty() ? "" : &m_vBuffer[0];
+		m_nSize = m_vBuffer.size();
+		return true;
+	}
+
+#if !defined(_WIN32)
+	int fd = open(szPath, O_RDONLY);
+	if (fd < 0)
+		return false;
+
+	struct stat st;
+	if (fstat(fd, &st) == 0 && st.st_size > 0)
+	{
+		void *p = mmap(0, size_t(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+		if (p != MAP_FAILED)
+		{
+#if defined(MADV_SEQUENTIAL)
+			madvise(p, size_t(st.st_size), MADV_SEQUENTIAL);
+#endif
+			m_pData = static_cast<const char*>(p);
+			m_nSize = size_t(st.st_size);
+			m_bMapped = true;
+		}
+	}
+
+	close(fd);
+	if (m_bMapped)
+		return true;
+#endif
+
+	// empty files, pipes, and systems without mmap are read into memory
+	FILE *fp = fopen(szPath, "rb");
+	if (!fp)
+		return false;
+
+	bool bRet = ReadAll(fp, m_vBuffer);
+	fclose(fp);
+
+	m_pData = m_vBuffer.empty() ? "" : &m_vBuffer[0];
+	m_nSize = m_vBuffer.size();
+
+	return bRet;
+}
+
+/// @brief		release the file
+/// @param		N/A
+/// @return		void
+void
+CMappedFile::Close()
+{
+#if !defined(_WIN32)
+	if (m_bMapped)
+		munmap(const_cast<char*>(m_pData), m_nSize);
+#endif
+
+	m_vBuffer.clear();
+	m_pData = 0;
+	m_nSize = 0;
+	m_bMapped = false;
+}
@@ -0,0 +1,44 @@
+///
+/// @file		MappedFile.h
+/// @author		Junpyo Hong (jp7.hong@gmail.com)
+/// @date		Oct. 18, 2026
+/// @version	1.0
+/// @brief		read-only view of a whole file (memory-mapped when possible)
+/// @remark		Tab size: 4
+///
+
+#ifndef _MAPPED_FILE_H_
+#define _MAPPED_FILE_H_
+
+#include <cstddef>		// size_t
+#include <vector>		// std::vector
+
+/// @brief		read-only view of a whole file (memory-mapped when possible)
+/// @remark		"-" reads the standard input into memory instead
+class CMappedFile
+{
+public:
+	explicit CMappedFile() : m_pData(0), m_nSize(0), m_bMapped(false) {}
+	~CMappedFile() { Close(); }
+
+	bool Open(const char *szPath);
+	void Close();
+
+	const char* GetData() const { return m_pData; }
+	size_t GetSize() const { return m_nSize; }
+
+private:
+	/// non construction-copyable
+	CMappedFile(const CMappedFile&);
+
+	/// non copyable
+	const CMappedFile& operator=(const CMappedFile&);
+
+private:
+	const char *m_pData;					///< first byte of the file
+	size_t m_nSize;							///< size of the file in bytes
+	bool m_bMapped;							///< true if m_pData is a mapping (otherwise m_vBuffer)
+	std::vector<char> m_vBuffer;			///< file contents when it can't be mapped
+};
+
+#endif // _MAPPED_FILE_H_
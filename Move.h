@@ -0,0 +1,143 @@
+///
+/// @file		Move.h
+/// @author		Junpyo Hong (jp7.hong@gmail.com)
+/// @date		Oct. 18, 2026
+/// @version	1.0
+/// @brief		packed 16-bit move and fixed-capacity move list
+/// @remark		Tab size: 4
+///
+
+#ifndef _MOVE_H_
+#define _MOVE_H_
+
+#include <cstdint>		// uint16_t
+#include <cassert>		// assert
+
+/// move packed in 16 bits: from (bit 0..5), to (bit 6..11), flags (bit 12..15)
+typedef uint16_t Move;
+
+/// move flags
+enum EMoveFlag { MOVE_QUIET = 0, MOVE_CAPTURE = 1 };
+
+/// no move (A1 to A1 is never generated)
+const Move MOVE_NONE = 0;
+
+/// upper bound of the number of moves in a position (with margin)
+#define MAX_MOVES	(256)
+
+/// @brief		pack a move
+inline Move
+PackMove(const int from, const int to, const int flags = MOVE_QUIET)
+{
+	return Move(from | (to << 6) | (flags << 12));
+}
+
+/// @brief		source square of a move
+inline int MoveFrom(const Move m) { return m & 0x3F; }
+
+/// @brief		destination square of a move
+inline int MoveTo(const Move m) { return (m >> 6) & 0x3F; }
+
+/// @brief		flags of a move (EMoveFlag)
+inline int MoveFlags(const Move m) { return m >> 12; }
+
+/// @brief		check whether a move captures a piece
+inline bool IsCapture(const Move m) { return (MoveFlags(m) & MOVE_CAPTURE) != 0; }
+
+/// @brief		write a move as the input protocol text (eg. "C3,D4")
+/// @param		m [in] move
+/// @param		sz [out] buffer of at least 6 characters
+/// @return		sz
+inline char*
+FormatMove(const Move m, char *sz)
+{
+	sz[0] = char('A' + (MoveFrom(m) & 7));
+	sz[1] = char('1' + (MoveFrom(m) >> 3));
+	sz[2] = ',';
+	sz[3] = char('A' + (MoveTo(m) & 7));
+	sz[4] = char('1' + (MoveTo(m) >> 3));
+	sz[5] = '\0';
+	return sz;
+}
+
+/// @brief		read a square of the input protocol text
+/// @param		sz [in] text such as "C3" (upper or lower case column)
+/// @return		square index, or -1 if it is not a square
+inline int
+ParseSquare(const char *sz)
+{
+	char col = sz[0];
+
+	if (col >= 'a' && col <= 'h')
+		col = char(col - 'a' + 'A');
+
+	if (col < 'A' || col > 'H' || sz[1] < '1' || sz[1] > '8')
+		return -1;
+
+	return (col - 'A') + (sz[1] - '1') * 8;
+}
+
+/// @brief		read the source and destination squares of the input protocol text
+/// @param		sz [in] text such as "C3,D4" (upper or lower case columns)
+/// @param		from [out] source square
+/// @param		to [out] destination square
+/// @return		true if the text is a well-formed move, otherwise false
+inline bool
+ParseSquares(const char *sz, int& from, int& to)
+{
+	// check each part in order so that a short text is never read past its end
+	if ((from = ParseSquare(sz)) < 0 || sz[2] != ',' || (to = ParseSquare(sz + 3)) < 0)
+		return false;
+
+	return true;
+}
+
+/// @brief		read the next space-separated move of a recorded game line
+/// @param		p [in,out] current character (moved past the move)
+/// @param		pEnd [in] end of the line
+/// @param		from [out] source square
+/// @param		to [out] destination square
+/// @return		1 for a move, 0 at the end of the line, -1 for a malformed move
+inline int
+ParseMoveToken(const char *&p, const char *pEnd, int& from, int& to)
+{
+	while (p < pEnd && (*p == ' ' || *p == '\t' || *p == '\r'))
+		p++;
+	if (p >= pEnd)
+		return 0;
+
+	if (pEnd - p < 5 || !ParseSquares(p, from, to) \
+		|| (pEnd - p > 5 && p[5] != ' ' && p[5] != '\t' && p[5] != '\r'))
+		return -1;
+
+	p += 5;
+	return 1;
+}
+
+/// @brief		fixed-capacity move list, meant to live on the caller's stack
+class CMoveList
+{
+public:
+	explicit CMoveList() : m_nSize(0) {}
+
+	void Clear() { m_nSize = 0; }
+	void Add(const Move m)
+	{
+		assert(m_nSize < MAX_MOVES);
+		m_arrMoves[m_nSize++] = m;
+	}
+
+	int Size() const { return m_nSize; }
+	Move operator[](const int i) const { return m_arrMoves[i]; }
+	Move& operator[](const int i) { return m_arrMoves[i]; }
+	const Move* begin() const { return m_arrMoves; }
+	const Move* end() const { return m_arrMoves + m_nSize; }
+	Move* begin() { return m_arrMoves; }
+	Move* end() { return m_arrMoves + m_nSize; }
+
+private:
+	Move m_arrMoves[MAX_MOVES];		///< generated moves
+	int m_nSize;					///< the number of generated moves
+};
+
+#endif // _MOVE_H_
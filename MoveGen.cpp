@@ -0,0 +1,178 @@
+///
+/// @file		MoveGen.cpp
+/// @author		Junpyo Hong (jp7.hong@gmail.com)
+/// @date		Oct. 18, 2026
+/// @version	1.0
+/// @brief		allocation-free move generation into a CMoveList
+/// @remark		Tab size: 4
+///
+
+#include "MoveGen.h"
+#include "Instrument.h"
+
+namespace
+{
+	/// @brief		generate pseudo-legal moves (all, captures, or quiet moves) of every piece of a side
+	template<int Side, int Gen>
+	inline void
+	GenerateSideMoves(const CPosition& pos, CMoveList& list)
+	{
+		GenerateMoves<TYPE_KING, Side, Gen>(pos, list);
+		GenerateMoves<TYPE_ROOK, Side, Gen>(pos, list);
+		GenerateMoves<TYPE_BISH, Side, Gen>(pos, list);
+		GenerateMoves<TYPE_PAWN, Side, Gen>(pos, list);
+	}
+}
+
+/// @brief		generate pseudo-legal moves of the side to move (same rules as CChessPiece classes)
+/// @param		pos [in] position
+/// @param		list [out] move list (moves are appended)
+/// @return		void
+void
+GenerateMoves(const CPosition& pos, CMoveList& list)
+{
+	INSTRUMENT_SCOPE(CNT_GENERATE_MOVES);
+
+	if (pos.GetSide() == SIDE_WHITE)
+		GenerateSideMoves<SIDE_WHITE, GEN_ALL>(pos, list);
+	else
+		GenerateSideMoves<SIDE_BLACK, GEN_ALL>(pos, list);
+}
+
+/// @brief		generate the pseudo-legal captures of the side to move (GenerateMoves() order)
+/// @param		pos [in] position
+/// @param		list [out] move list (moves are appended)
+/// @return		void
+void
+GenerateCaptures(const CPosition& pos, CMoveList& list)
+{
+	INSTRUMENT_SCOPE(CNT_GENERATE_MOVES);
+
+	if (pos.GetSide() == SIDE_WHITE)
+		GenerateSideMoves<SIDE_WHITE, GEN_CAPTURES>(pos, list);
+	else
+		GenerateSideMoves<SIDE_BLACK, GEN_CAPTURES>(pos, list);
+}
+
+/// @brief		generate the pseudo-legal quiet moves of the side to move (GenerateMoves() order)
+/// @param		pos [in] position
+/// @param		list [out] move list (moves are appended)
+/// @return		void
+void
+GenerateQuiets(const CPosition& pos, CMoveList& list)
+{
+	INSTRUMENT_SCOPE(CNT_GENERATE_MOVES);
+
+	if (pos.GetSide() == SIDE_WHITE)
+		GenerateSideMoves<SIDE_WHITE, GEN_QUIETS>(pos, list);
+	else
+		GenerateSideMoves<SIDE_BLACK, GEN_QUIETS>(pos, list);
+}
+
+/// @brief		check that a move (eg. from the transposition table) is one of GenerateMoves()
+/// @param		pos [in] position
+/// @param		m [in] move
+/// @return		true if the side to move has a piece on the source square which can move
+///				to the destination, and the capture flag matches the destination
+bool
+IsPseudoLegal(const CPosition& pos, const Move m)
+{
+	int from = MoveFrom(m);
+	int to = MoveTo(m);
+
+	if (m == MOVE_NONE || pos.GetSideAt(from) != pos.GetSide())
+		return false;
+
+	if (!(pos.GetTargets(from) & SqBB(to)))
+		return false;
+
+	return MoveFlags(m) == ((pos.GetSideAt(to) == (pos.GetSide() ^ 1)) ? MOVE_CAPTURE : MOVE_QUIET);
+}
+
+/// @brief		generate strictly legal moves of the side to move
+/// @param		pos [in] position (the side not to move should not be in check)
+/// @param		list [out] move list (moves are appended)
+/// @return		void
+/// @remark		unlike GenerateMoves(), the king never moves into check, no move leaves the
+///				own king in check, and the enemy king is never captured. pins and the check
+///				mask are computed once, so no move has to be made and taken back to test it.
+void
+GenerateLegalMoves(const CPosition& pos, CMoveList& list)
+{
+	INSTRUMENT_SCOPE(CNT_GENERATE_MOVES);
+
+	int side = pos.GetSide();
+	int enemy = side ^ 1;
+	if (!pos.HasKing(side))
+		return;
+
+	int ksq = pos.GetKingSq(side);
+	Bitboard bbOccupied = pos.GetOccupied();
+	Bitboard bbOwn = pos.GetSideBB(side);
+	Bitboard bbEnemy = pos.GetSideBB(enemy);
+	Bitboard bbTargetable = ~bbOwn & ~pos.GetPieces(enemy, TYPE_KING);
+	Bitboard bbCheckers = pos.GetAttackersTo(ksq, bbOccupied) & bbEnemy;
+	Bitboard bb;
+
+	// the king: a target must be safe once the king has left its square (no slider x-ray)
+	Bitboard bbOccNoKing = bbOccupied ^ SqBB(ksq);
+	for (bb = GetKingAttacks(ksq) & bbTargetable; bb; )
+	{
+		int to = PopLsb(bb);
+		if (!(pos.GetAttackersTo(to, bbOccNoKing) & bbEnemy))
+			list.Add(PackMove(ksq, to, (bbEnemy & SqBB(to)) ? MOVE_CAPTURE : MOVE_QUIET));
+	}
+
+	// only the king can answer a double check
+	if (bbCheckers & (bbCheckers - 1))
+		return;
+
+	// in check, the other pieces must capture the checker or block its ray
+	if (bbCheckers)
+		bbTargetable &= bbCheckers | GetBetween(ksq, Lsb(bbCheckers));
+
+	// a piece is pinned if it's the only piece between the king and an enemy slider
+	Bitboard bbPinned = 0;
+	Bitboard bbSnipers = (GetRookAttacks(ksq, 0) & pos.GetPieces(enemy, TYPE_ROOK)) \
+		| (GetBishAttacks(ksq, 0) & pos.GetPieces(enemy, TYPE_BISH));
+	while (bbSnipers)
+	{
+		Bitboard bbBlockers = GetBetween(ksq, PopLsb(bbSnipers)) & bbOccupied;
+		if (bbBlockers && !(bbBlockers & (bbBlockers - 1)))
+			bbPinned |= bbBlockers & bbOwn;
+	}
+
+	for (bb = pos.GetPieces(side, TYPE_ROOK); bb; )
+	{
+		int from = PopLsb(bb);
+		Bitboard bbTargets = GetRookAttacks(from, bbOccupied) & bbTargetable;
+		if (bbPinned & SqBB(from))
+			bbTargets &= GetLine(ksq, from);
+		SerializeMoves(from, bbTargets, bbEnemy, list);
+	}
+
+	for (bb = pos.GetPieces(side, TYPE_BISH); bb; )
+	{
+		int from = PopLsb(bb);
+		Bitboard bbTargets = GetBishAttacks(from, bbOccupied) & bbTargetable;
+		if (bbPinned & SqBB(from))
+			bbTargets &= GetLine(ksq, from);
+		SerializeMoves(from, bbTargets, bbEnemy, list);
+	}
+
+	int nForward = (side == SIDE_WHITE) ? BOARD_LEN : -BOARD_LEN;
+	for (bb = pos.GetPieces(side, TYPE_PAWN); bb; )
+	{
+		int from = PopLsb(bb);
+		int to = from + nForward;
+
+		Bitboard bbTargets = GetPawnAttacks(side, from) & bbEnemy;
+		if (to >= 0 && to < SQUARE_NB && !(bbOccupied & SqBB(to)))
+			bbTargets |= SqBB(to);
+
+		bbTargets &= bbTargetable;
+		if (bbPinned & SqBB(from))
+			bbTargets &= GetLine(ksq, from);
+		SerializeMoves(from, bbTargets, bbEnemy, list);
+	}
+}
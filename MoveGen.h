@@ -0,0 +1,114 @@
+///
+/// @file		MoveGen.h
+/// @author		Junpyo Hong (jp7.hong@gmail.com)
+/// @date		Oct. 18, 2026
+/// @version	1.0
+/// @brief		allocation-free move generation into a CMoveList
+/// @remark		Tab size: 4
+///
+
+#ifndef _MOVE_GEN_H_
+#define _MOVE_GEN_H_
+
+#include "Position.h"
+#include "Move.h"
+#include "Instrument.h"
+
+/// moves generated by GenerateMoves<Type, Side, Gen>
+enum EGenType { GEN_ALL = 0, GEN_CAPTURES, GEN_QUIETS };
+
+/// @brief		add a move for each target square of a piece
+/// @param		from [in] source square
+/// @param		bbTargets [in] destination squares
+/// @param		bbEnemy [in] enemy pieces (targets on them are flagged as captures)
+/// @param		list [out] move list
+inline void
+SerializeMoves(const int from, Bitboard bbTargets, const Bitboard bbEnemy, CMoveList& list)
+{
+	while (bbTargets)
+	{
+		int to = PopLsb(bbTargets);
+		list.Add(PackMove(from, to, (bbEnemy & SqBB(to)) ? MOVE_CAPTURE : MOVE_QUIET));
+	}
+}
+
+/// @brief		squares where a piece can move (same rules as CChessPiece classes, pseudo-legal)
+/// @param		pos [in] position
+/// @param		sq [in] square of a piece of Type and Side
+/// @return		destination squares
+/// @remark		Type and Side are template arguments, so the piece rule, the pawn direction,
+///				and the board edge are chosen at compile time (no switch, no virtual call)
+template<int Type, int Side>
+inline Bitboard
+GetPieceTargets(const CPosition& pos, const int sq)
+{
+	INSTRUMENT_SCOPE(CNT_TARGETS_KING + Type);
+
+	Bitboard bbNotOwn = ~pos.GetSideBB(Side);
+
+	switch (Type)
+	{
+	case TYPE_KING:
+		return GetKingAttacks(sq) & bbNotOwn;
+
+	case TYPE_ROOK:
+		return GetRookAttacks(sq, pos.GetOccupied()) & bbNotOwn;
+
+	case TYPE_BISH:
+		return GetBishAttacks(sq, pos.GetOccupied()) & bbNotOwn;
+
+	case TYPE_PAWN:
+	default:
+		{
+			// one square straight forward onto a vacant square, or diagonally onto an enemy
+			Bitboard bbPush = (Side == SIDE_WHITE) ? ShiftUp(SqBB(sq)) : ShiftDown(SqBB(sq));
+			return (bbPush & ~pos.GetOccupied()) | (GetPawnAttacks(Side, sq) & pos.GetSideBB(Side ^ 1));
+		}
+	}
+}
+
+/// @brief		generate pseudo-legal moves of the pieces of one type and side
+/// @param		pos [in] position
+/// @param		list [out] move list (moves are appended)
+/// @return		void
+/// @remark		a pawn's push comes before its captures (the order of the move list matters to the search).
+///				Gen (EGenType) keeps all moves, only the captures, or only the quiet moves.
+template<int Type, int Side, int Gen = GEN_ALL>
+inline void
+GenerateMoves(const CPosition& pos, CMoveList& list)
+{
+	const int FORWARD = (Side == SIDE_WHITE) ? BOARD_LEN : -BOARD_LEN;
+	Bitboard bbEnemy = pos.GetSideBB(Side ^ 1);
+	Bitboard bbMask = (Gen == GEN_CAPTURES) ? bbEnemy : (Gen == GEN_QUIETS) ? ~pos.GetOccupied() : ~Bitboard(0);
+
+	for (Bitboard bb = pos.GetPieces(Side, Type); bb; )
+	{
+		int from = PopLsb(bb);
+
+		if (Type == TYPE_PAWN)
+		{
+			// the pawn rule is inlined here (push before captures), so it is counted here
+			INSTRUMENT_SCOPE(CNT_TARGETS_PAWN);
+
+			// a pawn on the last row is stuck (pawns never promote in this variant)
+			int to = from + FORWARD;
+			if (Gen != GEN_CAPTURES && to >= 0 && to < SQUARE_NB && !(pos.GetOccupied() & SqBB(to)))
+				list.Add(PackMove(from, to, MOVE_QUIET));
+
+			if (Gen != GEN_QUIETS)
+				SerializeMoves(from, GetPawnAttacks(Side, from) & bbEnemy, bbEnemy, list);
+		}
+		else
+		{
+			SerializeMoves(from, GetPieceTargets<Type, Side>(pos, from) & bbMask, bbEnemy, list);
+		}
+	}
+}
+
+void GenerateMoves(const CPosition& pos, CMoveList& list);
+void GenerateCaptures(const CPosition& pos, CMoveList& list);
+void GenerateQuiets(const CPosition& pos, CMoveList& list);
+void GenerateLegalMoves(const CPosition& pos, CMoveList& list);
+bool IsPseudoLegal(const CPosition& pos, const Move m);
+
+#endif // _MOVE_GEN_H_
@@ -0,0 +1,119 @@
+///
+/// @file		MoveGenAllocTest.cpp
+/// @author		Junpyo Hong (jp7.hong@gmail.com)
+/// @date		Oct. 18, 2026
+/// @version	1.0
+/// @brief		movegen_alloc_test: move generation and make/unmake must not touch the heap
+/// @remark		Tab size: 4
+///
+
+#include <iostream>		// std::cout, std::cerr
+#include <cstdlib>		// malloc, free
+#include <new>			// std::bad_alloc
+
+#include "MoveGen.h"
+
+namespace
+{
+	/// calls of operator new since program start (the test is single-threaded)
+	unsigned long s_nAllocs = 0;
+
+	/// positions the tree walk starts from (FEN of this variant)
+	const char *s_arrTestFen[] =
+	{
+		"r1b1kb1r/pppppppp/8/8/8/8/PPPPPPPP/R1B1KB1R w",
+		"r1b1k3/p1pp1pr1/1p2p2p/2b3p1/1P1P4/P1P1B3/4PPPP/R3KBR1 w",
+		"8/p2rp1r1/3p1p2/pP2k1B1/3P3p/P2P3b/2K2PP1/4RR2 w",
+	};
+
+	/// @brief		walk the move tree with every generator (the work of perft and the search)
+	/// @return		leaf nodes
+	uint64_t
+	WalkTree(CPosition& pos, const int depth)
+	{
+		if (depth == 0 || !pos.HasKing(pos.GetSide()))
+			return 1;
+
+		CMoveList listLegal, listCaptures, listQuiets;
+		GenerateLegalMoves(pos, listLegal);
+		GenerateCaptures(pos, listCaptures);
+		GenerateQuiets(pos, listQuiets);
+
+		CMoveList list;
+		GenerateMoves(pos, list);
+
+		uint64_t nNodes = uint64_t(listLegal.Size() + listCaptures.Size() + listQuiets.Size());
+		SUndoInfo undo;
+		for (int i = 0; i < list.Size(); i++)
+		{
+			pos.MakeMove(list[i], undo);
+			nNodes += WalkTree(pos, depth - 1);
+			pos.UnmakeMove(list[i], undo);
+		}
+
+		return nNodes;
+	}
+}
+
+/// @brief		counting replacement of the global operator new (the deletes below pair with it)
+void*
+operator new(std::size_t nSize)
+{
+	s_nAllocs++;
+
+	void *p = malloc(nSize ? nSize : 1);
+	if (!p)
+		throw std::bad_alloc();
+
+	return p;
+}
+
+void
+operator delete(void *p) noexcept
+{
+	free(p);
+}
+
+void
+operator delete(void *p, std::size_t) noexcept
+{
+	free(p);
+}
+
+/// @brief		main function of movegen_alloc_test
+/// @param		argc [in] the number of arguments (unused)
+/// @param		argv [in] character array of arguments (unused)
+/// @return		0 if no allocation happened during move generation, otherwise 1
+int main(int argc, char *argv[])
+{
+	(void)argc;
+	(void)argv;
+
+	const int FEN_NB = int(sizeof(s_arrTestFen) / sizeof(s_arrTestFen[0]));
+	CPosition arrPos[FEN_NB];
+	for (int i = 0; i < FEN_NB; i++)
+	{
+		if (!arrPos[i].SetFen(s_arrTestFen[i]))
+		{
+			std::cerr << "bad test position " << s_arrTestFen[i] << std::endl;
+			return 1;
+		}
+	}
+
+	// the positions (and any static tables) are ready: nothing below may allocate
+	unsigned long nAllocsBefore = s_nAllocs;
+	uint64_t nNodes = 0;
+	for (int i = 0; i < FEN_NB; i++)
+		nNodes += WalkTree(arrPos[i], 3);
+	unsigned long nAllocs = s_nAllocs - nAllocsBefore;
+
+	std::cout << "nodes " << nNodes << ", heap allocations " << nAllocs << std::endl;
+	if (nAllocs != 0)
+	{
+		std::cerr << "FAIL  move generation allocated from the heap" << std::endl;
+		return 1;
+	}
+
+	std::cout << "ok" << std::endl;
+	return 0;
+}
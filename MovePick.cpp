@@ -0,0 +1,202 @@
+///
+/// @file		MovePick.cpp
+/// @author		Junpyo Hong (jp7.hong@gmail.com)
+/// @date		Oct. 18, 2026
+/// @version	1.0
+/// @brief		staged move ordering for the search (table move, captures, killers, history)
+/// @remark		Tab size: 4
+///
+
+#include <cstring>		// memset
+#include <algorithm>	// std::swap
+
+#include "MovePick.h"
+#include "MoveGen.h"
+#include "See.h"
+
+namespace
+{
+	/// rank of each piece type for MVV-LVA (K, R, B, P): the king is the most valuable victim
+	/// (capturing it ends the game) and the least wanted attacker
+	const int s_arrMvvLvaRank[TYPE_NB] = { 4, 3, 2, 1 };
+}
+
+/// @brief		forget every score
+/// @param		N/A
+/// @return		void
+void
+SHistory::Clear()
+{
+	memset(arrScore, 0, sizeof(arrScore));
+}
+
+/// @brief		reward a quiet move which caused a beta cutoff
+/// @param		m [in] the move
+/// @param		bonus [in] reward (deeper cutoffs are worth more)
+/// @return		void
+/// @remark		the scores are halved when one gets too large, so older cutoffs fade out
+void
+SHistory::Add(const Move m, const int bonus)
+{
+	int& score = arrScore[MoveFrom(m)][MoveTo(m)];
+
+	score += bonus;
+	if (score >= HISTORY_MAX)
+	{
+		for (int from = 0; from < SQUARE_NB; from++)
+			for (int to = 0; to < SQUARE_NB; to++)
+				arrScore[from][to] /= 2;
+	}
+}
+
+/// @brief		constructor (nothing is generated until Next())
+/// @param		pos [in] position (must outlive the picker and stay unchanged between calls of Next())
+/// @param		ttMove [in] move to try first (MOVE_NONE or an unchecked table move)
+/// @param		pKillers [in] KILLER_NB killer moves of this ply (MOVE_NONE if unused)
+/// @param		history [in] quiet move statistics of the side to move
+/// @return		N/A
+CMovePicker::CMovePicker(const CPosition& pos, const Move ttMove, const Move *pKillers, const SHistory& history)
+: m_pos(pos), m_pHistory(&history), m_ttMove(ttMove), m_nStage(PICK_TT), m_nCur(0)
+{
+	// a repeated killer is dropped so that no move is returned twice
+	for (int i = 0; i < KILLER_NB; i++)
+		m_arrKillers[i] = (i > 0 && pKillers[i] == pKillers[0]) ? MOVE_NONE : pKillers[i];
+}
+
+/// @brief		constructor of the quiescence search: captures which don't lose material only
+/// @param		pos [in] position (must outlive the picker and stay unchanged between calls of Next())
+/// @return		N/A
+CMovePicker::CMovePicker(const CPosition& pos)
+: m_pos(pos), m_pHistory(0), m_ttMove(MOVE_NONE), m_nStage(PICK_CAPTURES_GEN), m_nCur(0)
+{
+	for (int i = 0; i < KILLER_NB; i++)
+		m_arrKillers[i] = MOVE_NONE;
+}
+
+/// @brief		take the highest scored move of m_list which hasn't been returned yet
+/// @param		N/A
+/// @return		the move (m_nCur < m_list.Size() must hold)
+/// @remark		a selection step instead of a full sort: after a cutoff the rest is never sorted
+Move
+CMovePicker::PickBest()
+{
+	int best = m_nCur;
+	for (int i = m_nCur + 1; i < m_list.Size(); i++)
+	{
+		if (m_arrScores[i] > m_arrScores[best])
+			best = i;
+	}
+
+	std::swap(m_list[m_nCur], m_list[best]);
+	std::swap(m_arrScores[m_nCur], m_arrScores[best]);
+
+	return m_list[m_nCur++];
+}
+
+/// @brief		next move to search
+/// @param		N/A
+/// @return		the move, or MOVE_NONE when every move has been returned
+/// @remark		order: the table move, captures by MVV-LVA (most valuable victim, then least
+///				valuable attacker), killer moves, quiet moves by history score, then the
+///				captures which lose material by See()
+Move
+CMovePicker::Next()
+{
+	Move m;
+
+	switch (m_nStage)
+	{
+	case PICK_TT:
+		m_nStage = PICK_CAPTURES_GEN;
+		if (m_ttMove != MOVE_NONE && IsPseudoLegal(m_pos, m_ttMove))
+			return m_ttMove;
+
+		// a table move from another position (a key collision) is dropped
+		m_ttMove = MOVE_NONE;
+		// fall through
+
+	case PICK_CAPTURES_GEN:
+		GenerateCaptures(m_pos, m_list);
+		for (int i = 0; i < m_list.Size(); i++)
+		{
+			int victim = m_pos.GetTypeAt(MoveTo(m_list[i]));
+			int attacker = m_pos.GetTypeAt(MoveFrom(m_list[i]));
+			m_arrScores[i] = s_arrMvvLvaRank[victim] * 8 - s_arrMvvLvaRank[attacker];
+		}
+		m_nCur = 0;
+		m_nStage = PICK_CAPTURES;
+		// fall through
+
+	case PICK_CAPTURES:
+		while (m_nCur < m_list.Size())
+		{
+			m = PickBest();
+			if (m == m_ttMove)
+				continue;
+
+			// taking a piece worth at least the attacker never loses material
+			int victim = m_pos.GetTypeAt(MoveTo(m));
+			int attacker = m_pos.GetTypeAt(MoveFrom(m));
+			if (s_arrMvvLvaRank[victim] >= s_arrMvvLvaRank[attacker] || See(m_pos, m) >= 0)
+				return m;
+
+			// the quiescence search drops it, the main search tries it last
+			if (m_pHistory)
+				m_listBad.Add(m);
+		}
+
+		if (!m_pHistory)
+		{
+			m_nStage = PICK_DONE;
+			return MOVE_NONE;
+		}
+
+		m_nCur = 0;
+		m_nStage = PICK_KILLERS;
+		// fall through
+
+	case PICK_KILLERS:
+		while (m_nCur < KILLER_NB)
+		{
+			m = m_arrKillers[m_nCur++];
+			if (m != MOVE_NONE && m != m_ttMove && !IsCapture(m) && IsPseudoLegal(m_pos, m))
+				return m;
+
+			// a killer which isn't a move here mustn't be skipped among the quiet moves
+			m_arrKillers[m_nCur - 1] = MOVE_NONE;
+		}
+		m_nStage = PICK_QUIETS_GEN;
+		// fall through
+
+	case PICK_QUIETS_GEN:
+		m_list.Clear();
+		GenerateQuiets(m_pos, m_list);
+		for (int i = 0; i < m_list.Size(); i++)
+			m_arrScores[i] = m_pHistory->Get(m_list[i]);
+		m_nCur = 0;
+		m_nStage = PICK_QUIETS;
+		// fall through
+
+	case PICK_QUIETS:
+		while (m_nCur < m_list.Size())
+		{
+			m = PickBest();
+			if (m != m_ttMove && m != m_arrKillers[0] && m != m_arrKillers[1])
+				return m;
+		}
+		m_nCur = 0;
+		m_nStage = PICK_BAD_CAPTURES;
+		// fall through
+
+	case PICK_BAD_CAPTURES:
+		// in MVV-LVA order, as they were put aside
+		if (m_nCur < m_listBad.Size())
+			return m_listBad[m_nCur++];
+		m_nStage = PICK_DONE;
+		// fall through
+
+	case PICK_DONE:
+	default:
+		return MOVE_NONE;
+	}
+}
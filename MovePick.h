@@ -0,0 +1,71 @@
+///
+/// @file		MovePick.h
+/// @author		Junpyo Hong (jp7.hong@gmail.com)
+/// @date		Oct. 18, 2026
+/// @version	1.0
+/// @brief		staged move ordering for the search (table move, captures, killers, history)
+/// @remark		Tab size: 4
+///
+
+#ifndef _MOVE_PICK_H_
+#define _MOVE_PICK_H_
+
+#include "Position.h"
+#include "Move.h"
+
+/// killer moves kept for each ply
+const int KILLER_NB = 2;
+
+/// a history score which reaches this halves the whole table
+const int HISTORY_MAX = 1 << 20;
+
+/// stages of CMovePicker::Next(), in order
+enum EPickStage { PICK_TT = 0, PICK_CAPTURES_GEN, PICK_CAPTURES, PICK_KILLERS, PICK_QUIETS_GEN, PICK_QUIETS, \
+	PICK_BAD_CAPTURES, PICK_DONE };
+
+/// @brief		quiet move statistics of one side: how much each (from, to) caused beta cutoffs
+struct SHistory
+{
+	int arrScore[SQUARE_NB][SQUARE_NB];		///< score of each source and destination square
+
+	void Clear();
+	void Add(const Move m, const int bonus);
+	int Get(const Move m) const { return arrScore[MoveFrom(m)][MoveTo(m)]; }
+};
+
+/// @brief		pseudo-legal moves of a position, best guesses first
+/// @remark		each stage is generated only when the previous one is used up, so a cutoff
+///				on the table move or a capture never generates the quiet moves. Every move
+///				of GenerateMoves() is returned exactly once. The picker of the quiescence
+///				search returns only the captures which don't lose material (see See()).
+class CMovePicker
+{
+public:
+	explicit CMovePicker(const CPosition& pos, const Move ttMove, const Move *pKillers, const SHistory& history);
+	explicit CMovePicker(const CPosition& pos);
+
+	Move Next();
+
+private:
+	Move PickBest();
+
+private:
+	/// non construction-copyable
+	CMovePicker(const CMovePicker&);
+
+	/// non copyable
+	const CMovePicker& operator=(const CMovePicker&);
+
+private:
+	const CPosition& m_pos;				///< position (unchanged while moves are picked)
+	const SHistory *m_pHistory;			///< quiet move order (0 for captures only)
+	Move m_ttMove;						///< transposition table move (MOVE_NONE if none)
+	Move m_arrKillers[KILLER_NB];		///< killer moves of this ply
+	int m_nStage;						///< EPickStage
+	int m_nCur;							///< next move of m_list (or killer, or bad capture) to look at
+	CMoveList m_list;					///< captures or quiet moves of the current stage
+	int m_arrScores[MAX_MOVES];			///< order score of each move of m_list
+	CMoveList m_listBad;				///< captures which lose material, tried after the quiet moves
+};
+
+#endif // _MOVE_PICK_H_
@@ -0,0 +1,387 @@
+///
+/// @file		Nnue.cpp
+/// @author		Junpyo Hong (jp7.hong@gmail.com)
+/// @date		Oct. 18, 2026
+/// @version	1.0
+/// @brief		optional neural-network evaluation with an incrementally updated accumulator
+/// @remark		Tab size: 4
+///
+
+#include <cstring>		// memcmp, memcpy
+#include <cstdio>		// fprintf
+#include <cstdlib>		// abort
+
+#include "Nnue.h"
+#include "EvalBatch.h"	// EBatchIsa, IsBatchIsaSupported
+#include "CpuFeatures.h"
+
+#if defined(CHESS_X86)
+#include <immintrin.h>	// SSSE3 and AVX2 intrinsics
+#endif
+
+namespace
+{
+	/// bytes of the weights after the header
+	const size_t NNUE_WEIGHT_BYTES = sizeof(int16_t) * NNUE_L1 \
+		+ sizeof(int16_t) * size_t(NNUE_INPUTS) * NNUE_L1 \
+		+ sizeof(int32_t) * NNUE_L2 + sizeof(int8_t) * NNUE_L2 * 2 * NNUE_L1 \
+		+ sizeof(int8_t) * NNUE_L2 + sizeof(int32_t);
+
+	/// @brief		clip an accumulator value to an activation in [0, NNUE_QA]
+	inline uint8_t
+	ClipActivation(const int v)
+	{
+		return uint8_t(v < 0 ? 0 : v > NNUE_QA ? NNUE_QA : v);
+	}
+
+	/// @brief		second layer: bias plus the dot product of the clipped accumulators with each row
+	/// @param		pOwn [in] accumulator of the side to move [L1]
+	/// @param		pOther [in] accumulator of the other side [L1]
+	/// @param		pWeights [in] weights [L2][2 * L1]
+	/// @param		pBias [in] bias [L2]
+	/// @param		pOut [out] sums [L2]
+	void
+	HiddenLayerScalar(const int16_t *pOwn, const int16_t *pOther, const int8_t *pWeights, \
+		const int32_t *pBias, int32_t *pOut)
+	{
+		uint8_t arrIn[2 * NNUE_L1];
+		for (int i = 0; i < NNUE_L1; i++)
+		{
+			arrIn[i] = ClipActivation(pOwn[i]);
+			arrIn[NNUE_L1 + i] = ClipActivation(pOther[i]);
+		}
+
+		for (int j = 0; j < NNUE_L2; j++)
+		{
+			int32_t sum = pBias[j];
+			for (int i = 0; i < 2 * NNUE_L1; i++)
+				sum += int32_t(arrIn[i]) * pWeights[j * 2 * NNUE_L1 + i];
+			pOut[j] = sum;
+		}
+	}
+
+	/// @brief		first layer: a base row plus some rows minus others
+	/// @param		pBase [in] accumulator before the change (or the bias) [L1]
+	/// @param		ppAdd [in] rows to add
+	/// @param		nAdd [in] number of rows to add
+	/// @param		ppSub [in] rows to subtract
+	/// @param		nSub [in] number of rows to subtract
+	/// @param		pOut [out] accumulator after the change [L1] (may be pBase)
+	void
+	AccumulateScalar(const int16_t *pBase, const int16_t *const *ppAdd, const int nAdd, \
+		const int16_t *const *ppSub, const int nSub, int16_t *pOut)
+	{
+		if (pOut != pBase)
+			memcpy(pOut, pBase, sizeof(int16_t) * NNUE_L1);
+
+		for (int n = 0; n < nAdd; n++)
+			for (int i = 0; i < NNUE_L1; i++)
+				pOut[i] = int16_t(pOut[i] + ppAdd[n][i]);
+
+		for (int n = 0; n < nSub; n++)
+			for (int i = 0; i < NNUE_L1; i++)
+				pOut[i] = int16_t(pOut[i] - ppSub[n][i]);
+	}
+
+#if defined(CHESS_X86)
+
+	/// @brief		HiddenLayerScalar() with PMADDUBSW/PMADDWD on 16 bytes at a time
+	/// @remark		the clip is PACKUSWB (saturates to [0, 255]) and PMINUB, and four rows
+	///				share the horizontal sum (PHADDD)
+	CHESS_TARGET("ssse3") void
+	HiddenLayerSsse3(const int16_t *pOwn, const int16_t *pOther, const int8_t *pWeights, \
+		const int32_t *pBias, int32_t *pOut)
+	{
+		const int IN_NB = 2 * NNUE_L1 / 16;
+		const __m128i vMax = _mm_set1_epi8(NNUE_QA);
+		const __m128i vOnes = _mm_set1_epi16(1);
+
+		__m128i arrIn[IN_NB];
+		for (int k = 0; k < IN_NB; k++)
+		{
+			const int16_t *p = (k < IN_NB / 2) ? pOwn + k * 16 : pOther + (k - IN_NB / 2) * 16;
+			arrIn[k] = _mm_min_epu8(_mm_packus_epi16(_mm_loadu_si128((const __m128i*)p), \
+				_mm_loadu_si128((const __m128i*)(p + 8))), vMax);
+		}
+
+		for (int j = 0; j < NNUE_L2; j += 4)
+		{
+			__m128i arrSum[4];
+			for (int r = 0; r < 4; r++)
+			{
+				const int8_t *pRow = pWeights + (j + r) * 2 * NNUE_L1;
+				arrSum[r] = _mm_setzero_si128();
+
+				// u8 * s8 pairs fit in int16: 2 * 127 * 127 < 32768
+				for (int k = 0; k < IN_NB; k++)
+				{
+					__m128i vProd = _mm_maddubs_epi16(arrIn[k], _mm_loadu_si128((const __m128i*)(pRow + k * 16)));
+					arrSum[r] = _mm_add_epi32(arrSum[r], _mm_madd_epi16(vProd, vOnes));
+				}
+			}
+
+			__m128i vSum = _mm_hadd_epi32(_mm_hadd_epi32(arrSum[0], arrSum[1]), _mm_hadd_epi32(arrSum[2], arrSum[3]));
+			vSum = _mm_add_epi32(vSum, _mm_loadu_si128((const __m128i*)(pBias + j)));
+			_mm_storeu_si128((__m128i*)(pOut + j), vSum);
+		}
+	}
+
+	/// @brief		HiddenLayerSsse3() on 32 bytes at a time
+	CHESS_TARGET("avx2") void
+	HiddenLayerAvx2(const int16_t *pOwn, const int16_t *pOther, const int8_t *pWeights, \
+		const int32_t *pBias, int32_t *pOut)
+	{
+		const int IN_NB = 2 * NNUE_L1 / 32;
+		const __m256i vMax = _mm256_set1_epi8(NNUE_QA);
+		const __m256i vOnes = _mm256_set1_epi16(1);
+
+		// VPACKUSWB packs within each 128-bit lane, VPERMQ puts the quarters back in order
+		__m256i arrIn[IN_NB];
+		for (int k = 0; k < IN_NB; k++)
+		{
+			const int16_t *p = (k < IN_NB / 2) ? pOwn + k * 32 : pOther + (k - IN_NB / 2) * 32;
+			__m256i vPacked = _mm256_packus_epi16(_mm256_loadu_si256((const __m256i*)p), \
+				_mm256_loadu_si256((const __m256i*)(p + 16)));
+			arrIn[k] = _mm256_min_epu8(_mm256_permute4x64_epi64(vPacked, _MM_SHUFFLE(3, 1, 2, 0)), vMax);
+		}
+
+		for (int j = 0; j < NNUE_L2; j += 4)
+		{
+			__m256i arrSum[4];
+			for (int r = 0; r < 4; r++)
+			{
+				const int8_t *pRow = pWeights + (j + r) * 2 * NNUE_L1;
+				arrSum[r] = _mm256_setzero_si256();
+
+				for (int k = 0; k < IN_NB; k++)
+				{
+					__m256i vProd = _mm256_maddubs_epi16(arrIn[k], \
+						_mm256_loadu_si256((const __m256i*)(pRow + k * 32)));
+					arrSum[r] = _mm256_add_epi32(arrSum[r], _mm256_madd_epi16(vProd, vOnes));
+				}
+			}
+
+			__m256i vSum = _mm256_hadd_epi32(_mm256_hadd_epi32(arrSum[0], arrSum[1]), \
+				_mm256_hadd_epi32(arrSum[2], arrSum[3]));
+			__m128i v = _mm_add_epi32(_mm256_castsi256_si128(vSum), _mm256_extracti128_si256(vSum, 1));
+			v = _mm_add_epi32(v, _mm_loadu_si128((const __m128i*)(pBias + j)));
+			_mm_storeu_si128((__m128i*)(pOut + j), v);
+		}
+	}
+
+	/// @brief		AccumulateScalar() with the sum held in four YMM registers
+	CHESS_TARGET("avx2") void
+	AccumulateAvx2(const int16_t *pBase, const int16_t *const *ppAdd, const int nAdd, \
+		const int16_t *const *ppSub, const int nSub, int16_t *pOut)
+	{
+		const int REG_NB = NNUE_L1 / 16;
+
+		__m256i arrSum[REG_NB];
+		for (int k = 0; k < REG_NB; k++)
+			arrSum[k] = _mm256_loadu_si256((const __m256i*)(pBase + k * 16));
+
+		for (int n = 0; n < nAdd; n++)
+			for (int k = 0; k < REG_NB; k++)
+				arrSum[k] = _mm256_add_epi16(arrSum[k], _mm256_loadu_si256((const __m256i*)(ppAdd[n] + k * 16)));
+
+		for (int n = 0; n < nSub; n++)
+			for (int k = 0; k < REG_NB; k++)
+				arrSum[k] = _mm256_sub_epi16(arrSum[k], _mm256_loadu_si256((const __m256i*)(ppSub[n] + k * 16)));
+
+		for (int k = 0; k < REG_NB; k++)
+			_mm256_storeu_si256((__m256i*)(pOut + k * 16), arrSum[k]);
+	}
+
+#endif // CHESS_X86
+}
+
+/// @brief		constructor (no network until Load() succeeds)
+/// @param		N/A
+/// @return		N/A
+CNnue::CNnue()
+: m_pFeatureBias(0), m_pFeatureWeights(0), m_pHiddenBias(0), m_pHiddenWeights(0), \
+	m_pOutputWeights(0), m_nOutputBias(0), m_nIsa(BATCH_SCALAR)
+{
+	m_nIsa = IsBatchIsaSupported(BATCH_AVX2) ? BATCH_AVX2 : \
+		IsBatchIsaSupported(BATCH_SSSE3) ? BATCH_SSSE3 : BATCH_SCALAR;
+}
+
+/// @brief		map a network file written by nnue_train
+/// @param		szPath [in] path of the file
+/// @return		true on success, false if the file can't be read or doesn't match this build
+bool
+CNnue::Load(const char *szPath)
+{
+	if (!m_file.Open(szPath))
+		return false;
+
+	const char *p = m_file.GetData();
+	SNnueHeader header;
+	if (m_file.GetSize() != sizeof(header) + NNUE_WEIGHT_BYTES)
+		return false;
+
+	memcpy(&header, p, sizeof(header));
+	if (memcmp(header.arrMagic, "CNN1", 4) != 0 || header.nVersion != NNUE_VERSION || \
+		header.nInputs != uint32_t(NNUE_INPUTS) || header.nL1 != uint32_t(NNUE_L1) || \
+		header.nL2 != uint32_t(NNUE_L2))
+		return false;
+
+	// the weights are used in place (the header keeps them aligned)
+	p += sizeof(header);
+	m_pFeatureBias = (const int16_t*)p;
+	p += sizeof(int16_t) * NNUE_L1;
+	m_pFeatureWeights = (const int16_t*)p;
+	p += sizeof(int16_t) * size_t(NNUE_INPUTS) * NNUE_L1;
+	m_pHiddenBias = (const int32_t*)p;
+	p += sizeof(int32_t) * NNUE_L2;
+	m_pHiddenWeights = (const int8_t*)p;
+	p += sizeof(int8_t) * NNUE_L2 * 2 * NNUE_L1;
+	m_pOutputWeights = (const int8_t*)p;
+	p += sizeof(int8_t) * NNUE_L2;
+	memcpy(&m_nOutputBias, p, sizeof(m_nOutputBias));
+
+	return true;
+}
+
+/// @brief		first layer: a base accumulator plus some features minus others
+/// @param		pBase [in] accumulator before the change (or the bias)
+/// @param		pAdd [in] features to add
+/// @param		nAdd [in] number of features to add
+/// @param		pSub [in] features to subtract
+/// @param		nSub [in] number of features to subtract
+/// @param		pOut [out] accumulator of one side
+/// @return		void
+void
+CNnue::Accumulate(const int16_t *pBase, const int *pAdd, const int nAdd, const int *pSub, \
+	const int nSub, int16_t *pOut) const
+{
+	const int16_t *arrAdd[PIECE_MAX];
+	const int16_t *arrSub[2];
+
+	for (int n = 0; n < nAdd; n++)
+		arrAdd[n] = m_pFeatureWeights + size_t(pAdd[n]) * NNUE_L1;
+	for (int n = 0; n < nSub; n++)
+		arrSub[n] = m_pFeatureWeights + size_t(pSub[n]) * NNUE_L1;
+
+#if defined(CHESS_X86)
+	if (m_nIsa == BATCH_AVX2)
+		AccumulateAvx2(pBase, arrAdd, nAdd, arrSub, nSub, pOut);
+	else
+#endif
+		AccumulateScalar(pBase, arrAdd, nAdd, arrSub, nSub, pOut);
+}
+
+/// @brief		compute the accumulator of one side from every piece
+/// @param		pos [in] position
+/// @param		acc [out] accumulator
+/// @param		perspective [in] side whose accumulator is computed
+/// @return		void
+/// @remark		a side without a king (the game is over) has no features
+void
+CNnue::RefreshSide(const CPosition& pos, SNnueAccumulator& acc, const int perspective) const
+{
+	int arrFeatures[PIECE_MAX];
+	int nFeatures = 0;
+
+	if (pos.HasKing(perspective))
+	{
+		int kingSq = pos.GetKingSq(perspective);
+		for (int idx = 0; idx < pos.GetPieceCount(); idx++)
+		{
+			int side = pos.GetPieceSide(idx);
+			int type = pos.GetPieceType(idx);
+
+			if (side != perspective || type != TYPE_KING)
+				arrFeatures[nFeatures++] = NnueFeature(perspective, kingSq, side, type, pos.GetPieceSq(idx));
+		}
+	}
+
+	Accumulate(m_pFeatureBias, arrFeatures, nFeatures, 0, 0, acc.arrValues[perspective]);
+}
+
+/// @brief		compute both accumulators from every piece
+/// @param		pos [in] position
+/// @param		acc [out] accumulator
+/// @return		void
+void
+CNnue::Refresh(const CPosition& pos, SNnueAccumulator& acc) const
+{
+	for (int perspective = 0; perspective < SIDE_NB; perspective++)
+		RefreshSide(pos, acc, perspective);
+}
+
+/// @brief		accumulator after a move: the features of the two squares change
+/// @param		accPrev [in] accumulator before the move
+/// @param		acc [out] accumulator after the move
+/// @param		pos [in] position after CPosition::MakeMove()
+/// @param		m [in] the move
+/// @param		undo [in] information filled by CPosition::MakeMove()
+/// @return		void
+/// @remark		a king move changes every feature of its own side, which is recomputed
+///				(as is a side whose king has just been captured)
+void
+CNnue::Update(const SNnueAccumulator& accPrev, SNnueAccumulator& acc, const CPosition& pos, \
+	const Move m, const SUndoInfo& undo) const
+{
+	int side = pos.GetSide() ^ 1;
+	int from = MoveFrom(m);
+	int to = MoveTo(m);
+
+	for (int perspective = 0; perspective < SIDE_NB; perspective++)
+	{
+		if ((undo.nMoved == TYPE_KING && side == perspective) || !pos.HasKing(perspective))
+		{
+			RefreshSide(pos, acc, perspective);
+			continue;
+		}
+
+		int kingSq = pos.GetKingSq(perspective);
+		int nTo = NnueFeature(perspective, kingSq, side, undo.nMoved, to);
+		int arrSub[2];
+		int nSub = 0;
+
+		arrSub[nSub++] = NnueFeature(perspective, kingSq, side, undo.nMoved, from);
+		if (undo.nCaptured != TYPE_NONE)
+			arrSub[nSub++] = NnueFeature(perspective, kingSq, side ^ 1, undo.nCaptured, to);
+
+		Accumulate(accPrev.arrValues[perspective], &nTo, 1, arrSub, nSub, acc.arrValues[perspective]);
+	}
+
+#ifdef CHESS_DEBUG_POSITION
+	SNnueAccumulator accFull;
+	Refresh(pos, accFull);
+	if (memcmp(&accFull, &acc, sizeof(acc)) != 0)
+	{
+		fprintf(stderr, "CNnue::Update: accumulator differs from a full refresh\n");
+		abort();
+	}
+#endif
+}
+
+/// @brief		score of the network for the side to move
+/// @param		acc [in] accumulator of the position
+/// @param		side [in] side to move
+/// @return		score in centipawns
+int
+CNnue::Evaluate(const SNnueAccumulator& acc, const int side) const
+{
+	const int16_t *pOwn = acc.arrValues[side];
+	const int16_t *pOther = acc.arrValues[side ^ 1];
+
+	int32_t arrHidden[NNUE_L2];
+#if defined(CHESS_X86)
+	if (m_nIsa == BATCH_AVX2)
+		HiddenLayerAvx2(pOwn, pOther, m_pHiddenWeights, m_pHiddenBias, arrHidden);
+	else if (m_nIsa == BATCH_SSSE3)
+		HiddenLayerSsse3(pOwn, pOther, m_pHiddenWeights, m_pHiddenBias, arrHidden);
+	else
+#endif
+		HiddenLayerScalar(pOwn, pOther, m_pHiddenWeights, m_pHiddenBias, arrHidden);
+
+	// the sums have the scale NNUE_QA * NNUE_QB, the next activations NNUE_QA
+	int32_t nOut = m_nOutputBias;
+	for (int j = 0; j < NNUE_L2; j++)
+		nOut += int32_t(ClipActivation(arrHidden[j] / NNUE_QB)) * m_pOutputWeights[j];
+
+	return int(int64_t(nOut) * NNUE_OUTPUT_SCALE / (NNUE_QA * NNUE_QB));
+}
@@ -0,0 +1,116 @@
+///
+/// @file		Nnue.h
+/// @author		Junpyo Hong (jp7.hong@gmail.com)
+/// @date		Oct. 18, 2026
+/// @version	1.0
+/// @brief		optional neural-network evaluation with an incrementally updated accumulator
+/// @remark		Tab size: 4
+///
+
+#ifndef _NNUE_H_
+#define _NNUE_H_
+
+#include <cstdint>		// int16_t, int8_t
+
+#include "Position.h"
+#include "MappedFile.h"
+
+/// kinds of piece features seen from one side: own R, B, P, then enemy K, R, B, P
+/// (the own king is the king square of the feature set, not a feature)
+const int NNUE_KINDS = 7;
+
+/// input features of one side: (own king square, piece kind, square)
+const int NNUE_INPUTS = SQUARE_NB * NNUE_KINDS * SQUARE_NB;
+
+/// accumulator width of one side (first layer)
+const int NNUE_L1 = 64;
+
+/// width of the second layer (input: both accumulators, side to move first)
+const int NNUE_L2 = 16;
+
+/// activation scale: a clipped activation of 1.0 is 127
+const int NNUE_QA = 127;
+
+/// weight scale of the second and the output layer
+const int NNUE_QB = 64;
+
+/// centipawns of a network output of 1.0
+const int NNUE_OUTPUT_SCALE = 400;
+
+/// @brief		header of a network file, followed by the quantized weights:
+///				int16 feature bias[L1], int16 feature weights[INPUTS][L1],
+///				int32 second bias[L2], int8 second weights[L2][2 * L1],
+///				int8 output weights[L2], int32 output bias (little endian)
+struct SNnueHeader
+{
+	char arrMagic[4];			///< "CNN1"
+	uint32_t nVersion;			///< NNUE_VERSION
+	uint32_t nInputs;			///< NNUE_INPUTS
+	uint32_t nL1;				///< NNUE_L1
+	uint32_t nL2;				///< NNUE_L2
+	uint32_t arrReserved[3];	///< 0 (keeps the weights 32-byte aligned)
+};
+
+/// network file format version
+const uint32_t NNUE_VERSION = 1;
+
+/// @brief		first layer of both sides, kept up to date move by move
+struct SNnueAccumulator
+{
+	int16_t arrValues[SIDE_NB][NNUE_L1];				///< from the point of view of each side
+};
+
+/// @brief		feature index of a piece seen from one side
+/// @param		perspective [in] side whose point of view is taken
+/// @param		kingSq [in] square of the king of that side
+/// @param		side [in] side of the piece
+/// @param		type [in] type of the piece (not the king of the perspective)
+/// @param		sq [in] square of the piece
+/// @return		index in [0, NNUE_INPUTS)
+/// @remark		black sees the board upside down, so both sides share the weights
+inline int
+NnueFeature(const int perspective, const int kingSq, const int side, const int type, const int sq)
+{
+	int orient = (perspective == SIDE_WHITE) ? 0 : SQ(0, BOARD_LEN - 1);
+	int kind = (side == perspective) ? type - 1 : 3 + type;
+
+	return ((kingSq ^ orient) * NNUE_KINDS + kind) * SQUARE_NB + (sq ^ orient);
+}
+
+/// @brief		quantized network read from a file (see SNnueHeader)
+class CNnue
+{
+public:
+	explicit CNnue();
+
+	bool Load(const char *szPath);
+
+	void Refresh(const CPosition& pos, SNnueAccumulator& acc) const;
+	void Update(const SNnueAccumulator& accPrev, SNnueAccumulator& acc, const CPosition& pos, \
+		const Move m, const SUndoInfo& undo) const;
+	int Evaluate(const SNnueAccumulator& acc, const int side) const;
+
+private:
+	void RefreshSide(const CPosition& pos, SNnueAccumulator& acc, const int perspective) const;
+	void Accumulate(const int16_t *pBase, const int *pAdd, const int nAdd, const int *pSub, \
+		const int nSub, int16_t *pOut) const;
+
+private:
+	/// non construction-copyable
+	CNnue(const CNnue&);
+
+	/// non copyable
+	const CNnue& operator=(const CNnue&);
+
+private:
+	CMappedFile m_file;						///< the network file (weights are read in place)
+	const int16_t *m_pFeatureBias;			///< first layer bias [L1]
+	const int16_t *m_pFeatureWeights;		///< first layer weights [INPUTS][L1]
+	const int32_t *m_pHiddenBias;			///< second layer bias [L2]
+	const int8_t *m_pHiddenWeights;			///< second layer weights [L2][2 * L1]
+	const int8_t *m_pOutputWeights;			///< output weights [L2]
+	int32_t m_nOutputBias;					///< output bias
+	int m_nIsa;								///< dot product code path (see EBatchIsa)
+};
+
+#endif // _NNUE_H_
@@ -0,0 +1,477 @@
+///
+/// @file		NnueTrain.cpp
+/// @author		Junpyo Hong (jp7.hong@gmail.com)
+/// @date		Oct. 18, 2026
+/// @version	1.0
+/// @brief		nnue_train: train a network on search scores and write it for --nnue
+/// @remark		Tab size: 4
+///
+
+#include <iostream>		// std::cout, std::cerr
+#include <iomanip>		// std::setprecision
+#include <vector>		// std::vector
+#include <random>		// std::mt19937_64
+#include <algorithm>	// std::shuffle, std::min, std::max
+#include <cmath>		// exp, floor
+#include <cstdio>		// fopen, fwrite
+#include <cstring>		// strcmp, memcpy
+#include <cstdlib>		// atoi, atof, strtoull
+
+#include "Nnue.h"
+#include "Eval.h"
+#include "MoveGen.h"
+#include "Search.h"
+#include "Instrument.h"
+
+namespace
+{
+	/// @brief		options of nnue_train
+	struct STrainOptions
+	{
+		int nPositions;			///< positions to generate and label (--positions N)
+		int nDepth;				///< search depth of the labels (--depth N)
+		int nEpochs;			///< passes over the training positions (--epochs N)
+		double dRate;			///< learning rate of the first epoch (--rate X)
+		uint64_t nSeed;			///< seed of the games and the initial weights (--seed N)
+		const char *szOut;		///< network file to write
+
+		STrainOptions() : nPositions(100000), nDepth(4), nEpochs(10), dRate(0.2), nSeed(1), szOut(0) {}
+	};
+
+	/// a played move is random this often (per mille), otherwise it's the searched best move
+	const int RANDOM_MOVE_PERMILLE = 300;
+
+	/// labels are clipped to this many centipawns (king captures included)
+	const int LABEL_MAX = 2000;
+
+	/// share of the positions kept out of training to measure the error (per cent)
+	const int VALIDATION_PERCENT = 10;
+
+	/// (kind, square) pairs: the feature index without the king square (see NnueFeature())
+	const int FACTOR_INPUTS = NNUE_KINDS * SQUARE_NB;
+
+	/// weight limits of the quantized layers (see SNnueHeader)
+	const float FEATURE_WEIGHT_MAX = 4.0f;
+	const float HIDDEN_WEIGHT_MAX = 127.0f / NNUE_QB;
+
+	/// @brief		a labeled position
+	struct SSample
+	{
+		CPosition pos;			///< position (its side to move has a king)
+		int nScore;				///< search score for the side to move in centipawns
+	};
+
+	/// @brief		the network in floating point (the layout of the quantized file)
+	/// @remark		a (kind, square) weight shared by every king square is trained next to each
+	///				feature weight and added to it when the file is written, so that rare king
+	///				squares still learn what a piece is worth
+	struct SFloatNet
+	{
+		std::vector<float> vFeatureWeights;			///< [INPUTS][L1]
+		std::vector<float> vFactorWeights;			///< [KINDS * SQUARE_NB][L1], shared by all king squares
+		float arrFeatureBias[NNUE_L1];				///< [L1]
+		float arrHiddenWeights[NNUE_L2][2 * NNUE_L1];	///< [L2][2 * L1]
+		float arrHiddenBias[NNUE_L2];				///< [L2]
+		float arrOutputWeights[NNUE_L2];			///< [L2]
+		float fOutputBias;							///< output bias
+	};
+
+	/// @brief		activations of one forward pass (kept for the backward pass)
+	struct SForward
+	{
+		int arrFeatures[SIDE_NB][PIECE_MAX];		///< active features, side to move first
+		int arrFeatureCount[SIDE_NB];				///< the number of active features
+		float arrIn[2 * NNUE_L1];					///< clipped first layer, side to move first
+		float arrHidden[NNUE_L2];					///< clipped second layer
+		float fOut;									///< output (centipawns / NNUE_OUTPUT_SCALE)
+	};
+
+	/// @brief		logistic function (scores to expected results)
+	inline float
+	Sigmoid(const float x)
+	{
+		return 1.0f / (1.0f + float(exp(-x)));
+	}
+
+	/// @brief		clip to [lo, hi]
+	inline float
+	Clip(const float x, const float lo, const float hi)
+	{
+		return (x < lo) ? lo : (x > hi) ? hi : x;
+	}
+
+	/// @brief		read the options of nnue_train
+	bool
+	ParseTrainOptions(int argc, char *argv[], STrainOptions& opt)
+	{
+		for (int i = 1; i < argc; i++)
+		{
+			if (strncmp(argv[i], "--", 2) != 0)
+			{
+				opt.szOut = argv[i];
+				continue;
+			}
+
+			if (i + 1 >= argc)
+				return false;
+
+			if (strcmp(argv[i], "--positions") == 0)
+				opt.nPositions = atoi(argv[++i]);
+			else if (strcmp(argv[i], "--depth") == 0)
+				opt.nDepth = atoi(argv[++i]);
+			else if (strcmp(argv[i], "--epochs") == 0)
+				opt.nEpochs = atoi(argv[++i]);
+			else if (strcmp(argv[i], "--rate") == 0)
+				opt.dRate = atof(argv[++i]);
+			else if (strcmp(argv[i], "--seed") == 0)
+				opt.nSeed = strtoull(argv[++i], 0, 10);
+			else
+				return false;
+		}
+
+		return opt.szOut && opt.nPositions > 0 && opt.nDepth > 0 && opt.nEpochs > 0;
+	}
+
+	/// @brief		play games (searched moves mixed with random ones) and label their positions
+	/// @param		opt [in] options
+	/// @param		vSamples [out] labeled positions
+	/// @return		void
+	void
+	GenerateSamples(const STrainOptions& opt, std::vector<SSample>& vSamples)
+	{
+		std::mt19937_64 rng(opt.nSeed);
+		CSearch search;
+		SSearchLimits limits;
+		limits.nDepth = opt.nDepth;
+		size_t nReport = 0;
+
+		while (int(vSamples.size()) < opt.nPositions)
+		{
+			CPosition pos;
+			pos.SetStartPos();
+
+			for (int ply = 0; ply < 2 * MAX_PLY && int(vSamples.size()) < opt.nPositions; ply++)
+			{
+				if (!pos.HasKing(SIDE_WHITE) || !pos.HasKing(SIDE_BLACK))
+					break;
+
+				CMoveList list;
+				GenerateMoves(pos, list);
+				if (list.Size() == 0)
+					break;
+
+				SSearchResult result = search.Go(pos, limits);
+				if (result.nScore > -SCORE_WIN_MIN && result.nScore < SCORE_WIN_MIN)
+				{
+					SSample sample;
+					sample.pos = pos;
+					sample.nScore = std::max(-LABEL_MAX, std::min(LABEL_MAX, result.nScore));
+					vSamples.push_back(sample);
+				}
+
+				Move m = result.bestMove;
+				if (m == MOVE_NONE || int(rng() % 1000) < RANDOM_MOVE_PERMILLE)
+					m = list[int(rng() % uint64_t(list.Size()))];
+
+				SUndoInfo undo;
+				pos.MakeMove(m, undo);
+			}
+
+			if (vSamples.size() >= nReport)
+			{
+				std::cerr << "\rlabeled " << vSamples.size() << " positions" << std::flush;
+				nReport += 10000;
+			}
+		}
+
+		std::cerr << "\rlabeled " << vSamples.size() << " positions" << std::endl;
+	}
+
+	/// @brief		random initial weights
+	void
+	InitNet(SFloatNet& net, std::mt19937_64& rng)
+	{
+		std::uniform_real_distribution<float> featureDist(-0.05f, 0.05f);
+		std::uniform_real_distribution<float> hiddenDist(-0.15f, 0.15f);
+		std::uniform_real_distribution<float> outputDist(-0.5f, 0.5f);
+
+		net.vFeatureWeights.assign(size_t(NNUE_INPUTS) * NNUE_L1, 0.0f);
+		net.vFactorWeights.resize(size_t(FACTOR_INPUTS) * NNUE_L1);
+		for (size_t i = 0; i < net.vFactorWeights.size(); i++)
+			net.vFactorWeights[i] = featureDist(rng);
+
+		for (int i = 0; i < NNUE_L1; i++)
+			net.arrFeatureBias[i] = 0.25f;
+
+		for (int j = 0; j < NNUE_L2; j++)
+		{
+			for (int k = 0; k < 2 * NNUE_L1; k++)
+				net.arrHiddenWeights[j][k] = hiddenDist(rng);
+			net.arrHiddenBias[j] = 0.1f;
+			net.arrOutputWeights[j] = outputDist(rng);
+		}
+
+		net.fOutputBias = 0.0f;
+	}
+
+	/// @brief		forward pass of the floating point network
+	void
+	Forward(const SFloatNet& net, const CPosition& pos, SForward& fwd)
+	{
+		int stm = pos.GetSide();
+
+		for (int i = 0; i < SIDE_NB; i++)
+		{
+			int perspective = (i == 0) ? stm : (stm ^ 1);
+			int kingSq = pos.GetKingSq(perspective);
+			float *pIn = &fwd.arrIn[i * NNUE_L1];
+
+			for (int k = 0; k < NNUE_L1; k++)
+				pIn[k] = net.arrFeatureBias[k];
+
+			fwd.arrFeatureCount[i] = 0;
+			for (int idx = 0; idx < pos.GetPieceCount(); idx++)
+			{
+				int side = pos.GetPieceSide(idx);
+				int type = pos.GetPieceType(idx);
+				if (side == perspective && type == TYPE_KING)
+					continue;
+
+				int nFeature = NnueFeature(perspective, kingSq, side, type, pos.GetPieceSq(idx));
+				fwd.arrFeatures[i][fwd.arrFeatureCount[i]++] = nFeature;
+
+				const float *pWeights = &net.vFeatureWeights[size_t(nFeature) * NNUE_L1];
+				const float *pFactor = &net.vFactorWeights[size_t(nFeature % FACTOR_INPUTS) * NNUE_L1];
+				for (int k = 0; k < NNUE_L1; k++)
+					pIn[k] += pWeights[k] + pFactor[k];
+			}
+
+			for (int k = 0; k < NNUE_L1; k++)
+				pIn[k] = Clip(pIn[k], 0.0f, 1.0f);
+		}
+
+		fwd.fOut = net.fOutputBias;
+		for (int j = 0; j < NNUE_L2; j++)
+		{
+			float z = net.arrHiddenBias[j];
+			for (int k = 0; k < 2 * NNUE_L1; k++)
+				z += net.arrHiddenWeights[j][k] * fwd.arrIn[k];
+
+			fwd.arrHidden[j] = Clip(z, 0.0f, 1.0f);
+			fwd.fOut += net.arrOutputWeights[j] * fwd.arrHidden[j];
+		}
+	}
+
+	/// @brief		one gradient step on a sample (squared error of the expected result)
+	/// @return		the error before the step
+	float
+	TrainSample(SFloatNet& net, const SSample& sample, const float fRate)
+	{
+		SForward fwd;
+		Forward(net, sample.pos, fwd);
+
+		float p = Sigmoid(fwd.fOut);
+		float t = Sigmoid(float(sample.nScore) / NNUE_OUTPUT_SCALE);
+		float g = (p - t) * p * (1.0f - p);
+
+		// output and second layer (a clipped unit passes no gradient)
+		float arrGradIn[2 * NNUE_L1] = { 0 };
+		for (int j = 0; j < NNUE_L2; j++)
+		{
+			float gHidden = g * net.arrOutputWeights[j];
+			net.arrOutputWeights[j] = Clip(net.arrOutputWeights[j] - fRate * g * fwd.arrHidden[j], \
+				-HIDDEN_WEIGHT_MAX, HIDDEN_WEIGHT_MAX);
+
+			if (fwd.arrHidden[j] <= 0.0f || fwd.arrHidden[j] >= 1.0f)
+				continue;
+
+			for (int k = 0; k < 2 * NNUE_L1; k++)
+			{
+				arrGradIn[k] += gHidden * net.arrHiddenWeights[j][k];
+				net.arrHiddenWeights[j][k] = Clip(net.arrHiddenWeights[j][k] - fRate * gHidden * fwd.arrIn[k], \
+					-HIDDEN_WEIGHT_MAX, HIDDEN_WEIGHT_MAX);
+			}
+			net.arrHiddenBias[j] -= fRate * gHidden;
+		}
+		net.fOutputBias -= fRate * g;
+
+		// first layer: only the rows of the active features (both sides share the weights)
+		for (int i = 0; i < SIDE_NB; i++)
+		{
+			const float *pIn = &fwd.arrIn[i * NNUE_L1];
+			float arrGrad[NNUE_L1];
+			for (int k = 0; k < NNUE_L1; k++)
+			{
+				arrGrad[k] = (pIn[k] > 0.0f && pIn[k] < 1.0f) ? fRate * arrGradIn[i * NNUE_L1 + k] : 0.0f;
+				net.arrFeatureBias[k] -= arrGrad[k];
+			}
+
+			for (int f = 0; f < fwd.arrFeatureCount[i]; f++)
+			{
+				float *pWeights = &net.vFeatureWeights[size_t(fwd.arrFeatures[i][f]) * NNUE_L1];
+				float *pFactor = &net.vFactorWeights[size_t(fwd.arrFeatures[i][f] % FACTOR_INPUTS) * NNUE_L1];
+				for (int k = 0; k < NNUE_L1; k++)
+				{
+					pWeights[k] = Clip(pWeights[k] - arrGrad[k], -FEATURE_WEIGHT_MAX, FEATURE_WEIGHT_MAX);
+					pFactor[k] = Clip(pFactor[k] - arrGrad[k], -FEATURE_WEIGHT_MAX, FEATURE_WEIGHT_MAX);
+				}
+			}
+		}
+
+		return (p - t) * (p - t);
+	}
+
+	/// @brief		round to the nearest integer within [lo, hi]
+	inline int
+	Quantize(const double x, const int lo, const int hi)
+	{
+		int n = int(floor(x + 0.5));
+		return (n < lo) ? lo : (n > hi) ? hi : n;
+	}
+
+	/// @brief		write the quantized network (see SNnueHeader)
+	/// @return		true on success, false on a write error
+	bool
+	WriteNet(const SFloatNet& net, const char *szPath)
+	{
+		SNnueHeader header;
+		memcpy(header.arrMagic, "CNN1", 4);
+		header.nVersion = NNUE_VERSION;
+		header.nInputs = NNUE_INPUTS;
+		header.nL1 = NNUE_L1;
+		header.nL2 = NNUE_L2;
+		header.arrReserved[0] = header.arrReserved[1] = header.arrReserved[2] = 0;
+
+		std::vector<int16_t> vFeatureBias(NNUE_L1);
+		std::vector<int16_t> vFeatureWeights(net.vFeatureWeights.size());
+		std::vector<int32_t> vHiddenBias(NNUE_L2);
+		std::vector<int8_t> vHiddenWeights(NNUE_L2 * 2 * NNUE_L1);
+		std::vector<int8_t> vOutputWeights(NNUE_L2);
+
+		for (int k = 0; k < NNUE_L1; k++)
+			vFeatureBias[k] = int16_t(Quantize(net.arrFeatureBias[k] * NNUE_QA, -32767, 32767));
+		for (size_t i = 0; i < vFeatureWeights.size(); i++)
+		{
+			float w = Clip(net.vFeatureWeights[i] + net.vFactorWeights[i % (size_t(FACTOR_INPUTS) * NNUE_L1)], \
+				-FEATURE_WEIGHT_MAX, FEATURE_WEIGHT_MAX);
+			vFeatureWeights[i] = int16_t(Quantize(w * NNUE_QA, -32767, 32767));
+		}
+
+		for (int j = 0; j < NNUE_L2; j++)
+		{
+			vHiddenBias[j] = Quantize(double(net.arrHiddenBias[j]) * NNUE_QA * NNUE_QB, -(1 << 30), 1 << 30);
+			for (int k = 0; k < 2 * NNUE_L1; k++)
+				vHiddenWeights[j * 2 * NNUE_L1 + k] = int8_t(Quantize(net.arrHiddenWeights[j][k] * NNUE_QB, -127, 127));
+			vOutputWeights[j] = int8_t(Quantize(net.arrOutputWeights[j] * NNUE_QB, -127, 127));
+		}
+		int32_t nOutputBias = Quantize(double(net.fOutputBias) * NNUE_QA * NNUE_QB, -(1 << 30), 1 << 30);
+
+		FILE *fp = fopen(szPath, "wb");
+		if (!fp)
+			return false;
+
+		bool bRet = fwrite(&header, sizeof(header), 1, fp) == 1 \
+			&& fwrite(&vFeatureBias[0], sizeof(int16_t), vFeatureBias.size(), fp) == vFeatureBias.size() \
+			&& fwrite(&vFeatureWeights[0], sizeof(int16_t), vFeatureWeights.size(), fp) == vFeatureWeights.size() \
+			&& fwrite(&vHiddenBias[0], sizeof(int32_t), vHiddenBias.size(), fp) == vHiddenBias.size() \
+			&& fwrite(&vHiddenWeights[0], sizeof(int8_t), vHiddenWeights.size(), fp) == vHiddenWeights.size() \
+			&& fwrite(&vOutputWeights[0], sizeof(int8_t), vOutputWeights.size(), fp) == vOutputWeights.size() \
+			&& fwrite(&nOutputBias, sizeof(nOutputBias), 1, fp) == 1;
+
+		return (fclose(fp) == 0) && bRet;
+	}
+
+	/// @brief		mean squared error of the expected result of a score function
+	template<typename FnScore>
+	double
+	MeasureError(const std::vector<SSample>& vSamples, const size_t nBegin, FnScore fnScore)
+	{
+		double dSum = 0;
+
+		for (size_t i = nBegin; i < vSamples.size(); i++)
+		{
+			double d = Sigmoid(float(fnScore(vSamples[i].pos)) / NNUE_OUTPUT_SCALE) \
+				- Sigmoid(float(vSamples[i].nScore) / NNUE_OUTPUT_SCALE);
+			dSum += d * d;
+		}
+
+		return dSum / double(vSamples.size() > nBegin ? vSamples.size() - nBegin : 1);
+	}
+}
+
+/// @brief		main function of nnue_train
+/// @param		argc [in] the number of arguments
+/// @param		argv [in] character array of arguments
+/// @return		0 on success, 1 on a bad option or a write error
+int main(int argc, char *argv[])
+{
+	InstallInstrumentReport();
+
+	STrainOptions opt;
+	if (!ParseTrainOptions(argc, argv, opt))
+	{
+		std::cerr << "usage: nnue_train [--positions N] [--depth N] [--epochs N] [--rate X] [--seed N] <file>" << std::endl;
+		std::cerr << "       labels positions of searched games with depth N scores, trains a network" << std::endl;
+		std::cerr << "       on them, and writes it for \"Chess --nnue <file>\"" << std::endl;
+		return 1;
+	}
+
+	std::vector<SSample> vSamples;
+	GenerateSamples(opt, vSamples);
+
+	std::mt19937_64 rng(opt.nSeed);
+	std::shuffle(vSamples.begin(), vSamples.end(), rng);
+	size_t nTrain = vSamples.size() - vSamples.size() * VALIDATION_PERCENT / 100;
+
+	SFloatNet net;
+	InitNet(net, rng);
+
+	for (int epoch = 0; epoch < opt.nEpochs; epoch++)
+	{
+		// the rate falls linearly to a tenth of the first one
+		float fRate = float(opt.dRate * (1.0 - 0.9 * epoch / opt.nEpochs));
+		double dSum = 0;
+
+		std::shuffle(vSamples.begin(), vSamples.begin() + nTrain, rng);
+		for (size_t i = 0; i < nTrain; i++)
+			dSum += TrainSample(net, vSamples[i], fRate);
+
+		double dValid = MeasureError(vSamples, nTrain, [&net](const CPosition& pos)
+		{
+			SForward fwd;
+			Forward(net, pos, fwd);
+			return fwd.fOut * NNUE_OUTPUT_SCALE;
+		});
+
+		std::cout << "epoch " << epoch + 1 << " rate " << fRate << std::fixed << std::setprecision(6) \
+			<< " train " << dSum / double(nTrain) << " validation " << dValid << std::endl;
+		std::cout.unsetf(std::ios::fixed);
+	}
+
+	if (!WriteNet(net, opt.szOut))
+	{
+		std::cerr << "cannot write " << opt.szOut << std::endl;
+		return 1;
+	}
+
+	// the written file as the engine reads it, against the hand-written evaluation
+	CNnue nnue;
+	if (!nnue.Load(opt.szOut))
+	{
+		std::cerr << "cannot read back " << opt.szOut << std::endl;
+		return 1;
+	}
+
+	double dNnue = MeasureError(vSamples, nTrain, [&nnue](const CPosition& pos)
+	{
+		SNnueAccumulator acc;
+		nnue.Refresh(pos, acc);
+		return nnue.Evaluate(acc, pos.GetSide());
+	});
+	double dHand = MeasureError(vSamples, nTrain, [](const CPosition& pos) { return Evaluate(pos); });
+
+	std::cout << std::fixed << std::setprecision(6) << "validation error: network " << dNnue \
+		<< ", hand-written " << dHand << " (" << vSamples.size() - nTrain << " positions)" << std::endl;
+
+	return 0;
+}
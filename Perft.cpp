@@ -0,0 +1,237 @@
+///
+/// @file		Perft.cpp
+/// @author		Junpyo Hong (jp7.hong@gmail.com)
+/// @date		Oct. 18, 2026
+/// @version	1.0
+/// @brief		move path enumeration (perft) for checking and timing the move generator
+/// @remark		Tab size: 4
+///
+
+#include <chrono>		// std::chrono::steady_clock
+#include <iomanip>		// std::setw
+
+#include "Perft.h"
+#include "MoveGen.h"
+
+namespace
+{
+	/// @brief		reference position of the perft suite
+	struct SPerftRef
+	{
+		const char *szName;			///< short description
+		const char *szMoves;		///< moves from the initial position
+		int nDepth;					///< depth to enumerate
+		uint64_t nNodes;			///< expected leaf count
+		uint64_t nLegalNodes;		///< expected leaf count with strictly legal moves
+	};
+
+	/// reference positions and node counts (this variant: K, R, B, and P only)
+	/// depth 4 counts were cross-checked with an independent mailbox move generator, the legal
+	/// counts with a filter of the pseudo-legal moves (no capture of the king, own king not attacked)
+	const SPerftRef s_arrPerftRefs[] =
+	{
+		{ "initial position",	"",										1, 11ULL,		11ULL },
+		{ "initial position",	"",										2, 121ULL,		121ULL },
+		{ "initial position",	"",										3, 1540ULL,		1540ULL },
+		{ "initial position",	"",										4, 19600ULL,	19572ULL },
+		{ "initial position",	"",										5, 289421ULL,	288180ULL },
+		{ "initial position",	"",										6, 4272252ULL,	4225610ULL },
+		{ "open bishops",		"E2,E3 D7,D6 F1,B5 C7,C6",				4, 143174ULL,	123571ULL },
+		{ "open bishops",		"E2,E3 D7,D6 F1,B5 C7,C6",				5, 2970212ULL,	2495605ULL },
+		{ "king in reach",		"E2,E3 D7,D6 F1,B5 E8,D7",				4, 95139ULL,	35509ULL },
+		{ "king in reach",		"E2,E3 D7,D6 F1,B5 E8,D7",				5, 2038323ULL,	740938ULL },
+		{ "rook lift",			"A2,A3 H7,H6 A3,A4 H6,H5 A1,A3 H8,H6",	4, 116776ULL,	116429ULL },
+		{ "rook lift",			"A2,A3 H7,H6 A3,A4 H6,H5 A1,A3 H8,H6",	5, 2156118ULL,	2142847ULL },
+	};
+
+	/// @brief		count the leaf nodes of the move tree with make/unmake
+	uint64_t
+	PerftRec(CPosition& pos, const int depth, const bool bLegal)
+	{
+		if (!pos.HasKing(pos.GetSide()))
+			return 0;
+
+		CMoveList list;
+		if (bLegal)
+			GenerateLegalMoves(pos, list);
+		else
+			GenerateMoves(pos, list);
+
+		if (depth == 1)
+			return uint64_t(list.Size());
+
+		uint64_t nNodes = 0;
+		SUndoInfo undo;
+		for (int i = 0; i < list.Size(); i++)
+		{
+			pos.MakeMove(list[i], undo);
+			nNodes += PerftRec(pos, depth - 1, bLegal);
+			pos.UnmakeMove(list[i], undo);
+		}
+
+		return nNodes;
+	}
+
+	/// @brief		elapsed seconds since a time point
+	inline double
+	SecondsSince(const std::chrono::steady_clock::time_point& t)
+	{
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - t).count();
+	}
+}
+
+/// @brief		count the leaf nodes of the move tree
+/// @param		pos [in] root position
+/// @param		depth [in] depth in plies
+/// @param		bLegal [in] true for strictly legal moves (see GenerateLegalMoves())
+/// @return		the number of move paths of the given length
+/// @remark		a side whose king has been captured has no moves (the game is over)
+uint64_t
+Perft(const CPosition& pos, const int depth, const bool bLegal)
+{
+	if (depth == 0)
+		return 1;
+
+	CPosition posWork = pos;
+	return PerftRec(posWork, depth, bLegal);
+}
+
+/// @brief		perft with a report of node count, time, and nodes/sec
+/// @param		pos [in] root position
+/// @param		depth [in] depth in plies (at least 1)
+/// @param		os [in] output stream of the report
+/// @param		bDivide [in] true to report the node count of each root move
+/// @param		bLegal [in] true for strictly legal moves (see GenerateLegalMoves())
+/// @return		the number of move paths of the given length
+uint64_t
+RunPerft(const CPosition& pos, const int depth, std::ostream& os, const bool bDivide,
+	const bool bLegal)
+{
+	std::chrono::steady_clock::time_point tBegin = std::chrono::steady_clock::now();
+	uint64_t nNodes = 0;
+	char szMove[6];
+	CPosition posWork = pos;
+	SUndoInfo undo;
+
+	CMoveList list;
+	if (bLegal)
+		GenerateLegalMoves(pos, list);
+	else if (pos.HasKing(pos.GetSide()))
+		GenerateMoves(pos, list);
+
+	for (int i = 0; i < list.Size(); i++)
+	{
+		posWork.MakeMove(list[i], undo);
+		uint64_t n = Perft(posWork, depth - 1, bLegal);
+		posWork.UnmakeMove(list[i], undo);
+		if (bDivide)
+			os << FormatMove(list[i], szMove) << ": " << n << std::endl;
+		nNodes += n;
+	}
+
+	double dSec = SecondsSince(tBegin);
+	if (bDivide)
+		os << std::endl;
+	os << "Moves: " << list.Size() << std::endl;
+	os << "Nodes: " << nNodes << std::endl;
+	os << "Time:  " << uint64_t(dSec * 1000) << " ms" << std::endl;
+	os << "NPS:   " << uint64_t(nNodes / (dSec > 0 ? dSec : 1e-9)) << std::endl;
+
+	return nNodes;
+}
+
+/// @brief		play moves in the input protocol text on a position
+/// @param		pos [in,out] position
+/// @param		szMoves [in] moves separated by spaces (eg. "E2,E3 D7,D6")
+/// @return		true if every move is a possible move, otherwise false
+bool
+ApplyMoveText(CPosition& pos, const char *szMoves)
+{
+	const char *p = szMoves;
+
+	while (*p)
+	{
+		if (*p == ' ')
+		{
+			p++;
+			continue;
+		}
+
+		int from, to;
+		if (!ParseSquares(p, from, to))
+			return false;
+
+		// the move must be one of the generated moves
+		CMoveList list;
+		GenerateMoves(pos, list);
+
+		Move m = MOVE_NONE;
+		for (int i = 0; i < list.Size(); i++)
+		{
+			if (MoveFrom(list[i]) == from && MoveTo(list[i]) == to)
+				m = list[i];
+		}
+
+		if (m == MOVE_NONE)
+			return false;
+
+		SUndoInfo undo;
+		pos.MakeMove(m, undo);
+		p += 5;
+	}
+
+	return true;
+}
+
+/// @brief		check the move generators against the reference node counts
+/// @param		os [in] output stream of the report
+/// @return		true if every count matches, otherwise false
+bool
+RunPerftSuite(std::ostream& os)
+{
+	bool bRet = true;
+	uint64_t nTotalNodes = 0;
+	double dTotalSec = 0;
+
+	for (size_t i = 0; i < sizeof(s_arrPerftRefs) / sizeof(s_arrPerftRefs[0]); i++)
+	{
+		const SPerftRef& ref = s_arrPerftRefs[i];
+
+		CPosition pos;
+		pos.SetStartPos();
+		if (!ApplyMoveText(pos, ref.szMoves))
+		{
+			os << "FAIL  " << ref.szName << ": bad move text" << std::endl;
+			bRet = false;
+			continue;
+		}
+
+		// both generators: this game's pseudo-legal moves, then strictly legal moves
+		for (int legal = 0; legal < 2; legal++)
+		{
+			bool bLegal = (legal != 0);
+			uint64_t nExpected = bLegal ? ref.nLegalNodes : ref.nNodes;
+
+			std::chrono::steady_clock::time_point tBegin = std::chrono::steady_clock::now();
+			uint64_t nNodes = Perft(pos, ref.nDepth, bLegal);
+			double dSec = SecondsSince(tBegin);
+
+			bool bPass = (nNodes == nExpected);
+			bRet = bRet && bPass;
+			nTotalNodes += nNodes;
+			dTotalSec += dSec;
+
+			os << (bPass ? "ok    " : "FAIL  ") << std::left << std::setw(18) << ref.szName \
+				<< std::right << " depth " << ref.nDepth << (bLegal ? " legal " : " pseudo") \
+				<< std::setw(12) << nNodes;
+			if (!bPass)
+				os << " (expected " << nExpected << ")";
+			os << std::endl;
+		}
+	}
+
+	os << "Nodes: " << nTotalNodes << std::endl;
+	os << "NPS:   " << uint64_t(nTotalNodes / (dTotalSec > 0 ? dTotalSec : 1e-9)) << std::endl;
+
+	return bRet;
+}
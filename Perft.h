@@ -0,0 +1,24 @@
+///
+/// @file		Perft.h
+/// @author		Junpyo Hong (jp7.hong@gmail.com)
+/// @date		Oct. 18, 2026
+/// @version	1.0
+/// @brief		move path enumeration (perft) for checking and timing the move generator
+/// @remark		Tab size: 4
+///
+
+#ifndef _PERFT_H_
+#define _PERFT_H_
+
+#include <cstdint>		// uint64_t
+#include <ostream>		// std::ostream
+
+#include "Position.h"
+
+uint64_t Perft(const CPosition& pos, const int depth, const bool bLegal = false);
+uint64_t RunPerft(const CPosition& pos, const int depth, std::ostream& os, const bool bDivide,
+	const bool bLegal = false);
+bool ApplyMoveText(CPosition& pos, const char *szMoves);
+bool RunPerftSuite(std::ostream& os);
+
+#endif // _PERFT_H_
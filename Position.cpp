@@ -0,0 +1,583 @@
+///
+/// @file		Position.cpp
+/// @author		Junpyo Hong (jp7.hong@gmail.com)
+/// @date		Oct. 18, 2026
+/// @version	1.0
+/// @brief		bitboard position (authoritative state of the chessboard)
+/// @remark		Tab size: 4
+///
+
+#include <cassert>		// assert
+#include <cstdio>		// fprintf
+#include <cstdlib>		// abort
+
+#include "Position.h"
+#include "MoveGen.h"		// GetPieceTargets
+#include "Eval.h"			// g_arrPsq
+
+namespace
+{
+	/// Zobrist keys of a piece on a square (indexed by side, type, and square)
+	uint64_t s_arrZobristPiece[SIDE_NB][TYPE_NB][SQUARE_NB];
+
+	/// Zobrist key of black to move
+	uint64_t s_nZobristSide;
+
+	/// @brief		fill the Zobrist keys once at program start-up (same keys every run)
+	struct SZobristInit
+	{
+		SZobristInit()
+		{
+			uint64_t s = 0x6A09E667F3BCC908ULL;
+
+			for (int side = 0; side < SIDE_NB; side++)
+				for (int type = 0; type < TYPE_NB; type++)
+					for (int sq = 0; sq < SQUARE_NB; sq++)
+						s_arrZobristPiece[side][type][sq] = NextKey(s);
+
+			s_nZobristSide = NextKey(s);
+		}
+
+		/// @brief		splitmix64 generator
+		static uint64_t
+		NextKey(uint64_t& s)
+		{
+			uint64_t z = (s += 0x9E3779B97F4A7C15ULL);
+			z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+			z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+			return z ^ (z >> 31);
+		}
+	} s_zobristInit;
+}
+
+/// @brief		remove all pieces and give the turn to white
+/// @param		N/A
+/// @return		void
+void
+CPosition::Clear()
+{
+	for (int side = 0; side < SIDE_NB; side++)
+	{
+		for (int type = 0; type < TYPE_NB; type++)
+			m_bbPieces[side][type] = 0;
+
+		m_bbSide[side] = 0;
+	}
+
+	m_bbOccupied = 0;
+	m_nSide = SIDE_WHITE;
+	m_nKey = 0;
+	m_nPsq = 0;
+
+	for (int sq = 0; sq < SQUARE_NB; sq++)
+		m_arrSqIndex[sq] = PIECE_NONE;
+
+	m_nPieceCount = 0;
+}
+
+/// @brief		set the initial position of this variant (K, R, B, and P only)
+/// @param		N/A
+/// @return		void
+void
+CPosition::SetStartPos()
+{
+	Clear();
+
+	for (int side = 0; side < SIDE_NB; side++)
+	{
+		int nBackRow = (side == SIDE_WHITE) ? 0 : BOARD_LEN - 1;
+		int nPawnRow = (side == SIDE_WHITE) ? 1 : BOARD_LEN - 2;
+
+		PutPiece(side, TYPE_KING, SQ(4, nBackRow));		// E
+		PutPiece(side, TYPE_ROOK, SQ(0, nBackRow));		// A
+		PutPiece(side, TYPE_ROOK, SQ(7, nBackRow));		// H
+		PutPiece(side, TYPE_BISH, SQ(2, nBackRow));		// C
+		PutPiece(side, TYPE_BISH, SQ(5, nBackRow));		// F
+
+		for (int x = 0; x < BOARD_LEN; x++)
+			PutPiece(side, TYPE_PAWN, SQ(x, nPawnRow));
+	}
+}
+
+/// @brief		set a position from FEN-style text (eg. "r1b1kb1r/pppppppp/8/8/8/8/PPPPPPPP/R1B1KB1R w")
+/// @param		szFen [in] rows 8 to 1 separated by '/' (K, R, B, P for white, k, r, b, p for black,
+///				digits for empty squares), a space, and the side to move ('w' or 'b', any case)
+/// @return		true on success, false if the text is malformed (the position is unchanged)
+/// @remark		anything after the side to move is ignored, so standard FEN fields may follow.
+///				a side may have no king (the game is over) but not two, and at most PIECE_MAX
+///				pieces fit in the piece list.
+bool
+CPosition::SetFen(const char *szFen)
+{
+	CPosition pos;
+	const char *p = szFen;
+	int x = 0;
+	int y = BOARD_LEN - 1;
+
+	for (; *p && *p != ' '; p++)
+	{
+		char c = *p;
+
+		if (c == '/')
+		{
+			if (x != BOARD_LEN || y == 0)
+				return false;
+			x = 0;
+			y--;
+		}
+		else if (c >= '1' && c <= '8')
+		{
+			x += c - '0';
+			if (x > BOARD_LEN)
+				return false;
+		}
+		else
+		{
+			int side = (c >= 'a' && c <= 'z') ? SIDE_BLACK : SIDE_WHITE;
+			int type = NameToType((side == SIDE_BLACK) ? char(c - 'a' + 'A') : c);
+			if (type == TYPE_NONE || x >= BOARD_LEN)
+				return false;
+			if (type == TYPE_KING && pos.HasKing(side))
+				return false;
+			if (pos.GetPieceCount() == PIECE_MAX)
+				return false;
+
+			pos.PutPiece(side, type, SQ(x, y));
+			x++;
+		}
+	}
+
+	if (x != BOARD_LEN || y != 0)
+		return false;
+
+	while (*p == ' ')
+		p++;
+
+	if (*p == 'b' || *p == 'B')
+		pos.FlipSide();
+	else if (*p != 'w' && *p != 'W')
+		return false;
+
+	if (p[1] != '\0' && p[1] != ' ')
+		return false;
+
+	*this = pos;
+	return true;
+}
+
+/// @brief		write the position as FEN-style text (see SetFen())
+/// @param		szFen [out] buffer of at least FEN_MAX characters
+/// @return		length of the text
+int
+CPosition::GetFen(char *szFen) const
+{
+	int n = 0;
+
+	for (int y = BOARD_LEN - 1; y >= 0; y--)
+	{
+		int nEmpty = 0;
+
+		for (int x = 0; x < BOARD_LEN; x++)
+		{
+			int side = GetSideAt(SQ(x, y));
+			if (side < 0)
+			{
+				nEmpty++;
+				continue;
+			}
+
+			if (nEmpty > 0)
+				szFen[n++] = char('0' + nEmpty);
+			nEmpty = 0;
+
+			char c = TypeToName(GetTypeAt(SQ(x, y)));
+			szFen[n++] = (side == SIDE_BLACK) ? char(c - 'A' + 'a') : c;
+		}
+
+		if (nEmpty > 0)
+			szFen[n++] = char('0' + nEmpty);
+		if (y > 0)
+			szFen[n++] = '/';
+	}
+
+	szFen[n++] = ' ';
+	szFen[n++] = (m_nSide == SIDE_WHITE) ? 'w' : 'b';
+	szFen[n] = '\0';
+
+	return n;
+}
+
+/// @brief		put a piece on an empty square
+/// @param		side [in] SIDE_WHITE or SIDE_BLACK
+/// @param		type [in] TYPE_KING, TYPE_ROOK, TYPE_BISH, or TYPE_PAWN
+/// @param		sq [in] square index
+/// @return		void
+void
+CPosition::PutPiece(const int side, const int type, const int sq)
+{
+	assert(!(m_bbOccupied & SqBB(sq)));
+
+	m_bbPieces[side][type] |= SqBB(sq);
+	m_bbSide[side] |= SqBB(sq);
+	m_bbOccupied |= SqBB(sq);
+	m_nKey ^= s_arrZobristPiece[side][type][sq];
+	m_nPsq += g_arrPsq[side][type][sq];
+
+	// append to the piece list
+	assert(m_nPieceCount < PIECE_MAX);
+	int idx = m_nPieceCount++;
+	m_arrPieceSq[idx] = uint8_t(sq);
+	m_arrPieceType[idx] = uint8_t(type);
+	m_arrPieceSide[idx] = uint8_t(side);
+	m_arrSqIndex[sq] = uint8_t(idx);
+}
+
+/// @brief		remove a piece from its square
+/// @param		side [in] SIDE_WHITE or SIDE_BLACK
+/// @param		type [in] TYPE_KING, TYPE_ROOK, TYPE_BISH, or TYPE_PAWN
+/// @param		sq [in] square index
+/// @return		void
+void
+CPosition::RemovePiece(const int side, const int type, const int sq)
+{
+	assert(m_bbPieces[side][type] & SqBB(sq));
+
+	m_bbPieces[side][type] ^= SqBB(sq);
+	m_bbSide[side] ^= SqBB(sq);
+	m_bbOccupied ^= SqBB(sq);
+	m_nKey ^= s_arrZobristPiece[side][type][sq];
+	m_nPsq -= g_arrPsq[side][type][sq];
+
+	// fill the hole in the piece list with the last piece
+	int idx = m_arrSqIndex[sq];
+	int last = --m_nPieceCount;
+	m_arrPieceSq[idx] = m_arrPieceSq[last];
+	m_arrPieceType[idx] = m_arrPieceType[last];
+	m_arrPieceSide[idx] = m_arrPieceSide[last];
+	m_arrSqIndex[m_arrPieceSq[idx]] = uint8_t(idx);
+	m_arrSqIndex[sq] = PIECE_NONE;
+}
+
+/// @brief		move a piece to an empty square
+/// @param		side [in] SIDE_WHITE or SIDE_BLACK
+/// @param		type [in] TYPE_KING, TYPE_ROOK, TYPE_BISH, or TYPE_PAWN
+/// @param		from [in] source square index
+/// @param		to [in] destination square index (must be vacant)
+/// @return		void
+void
+CPosition::MovePiece(const int side, const int type, const int from, const int to)
+{
+	assert(m_bbPieces[side][type] & SqBB(from));
+	assert(!(m_bbOccupied & SqBB(to)));
+
+	Bitboard bbFromTo = SqBB(from) | SqBB(to);
+	m_bbPieces[side][type] ^= bbFromTo;
+	m_bbSide[side] ^= bbFromTo;
+	m_bbOccupied ^= bbFromTo;
+	m_nKey ^= s_arrZobristPiece[side][type][from] ^ s_arrZobristPiece[side][type][to];
+	m_nPsq += g_arrPsq[side][type][to] - g_arrPsq[side][type][from];
+
+	int idx = m_arrSqIndex[from];
+	m_arrPieceSq[idx] = uint8_t(to);
+	m_arrSqIndex[to] = uint8_t(idx);
+	m_arrSqIndex[from] = PIECE_NONE;
+}
+
+/// @brief		give the turn to the other side
+/// @param		N/A
+/// @return		void
+void
+CPosition::FlipSide()
+{
+	m_nSide ^= 1;
+	m_nKey ^= s_nZobristSide;
+}
+
+/// @brief		play a move and give the turn to the other side
+/// @param		m [in] pseudo-legal move of the side to move
+/// @param		undo [out] information for UnmakeMove()
+/// @return		void
+/// @remark		only the source and destination squares are touched
+void
+CPosition::MakeMove(const Move m, SUndoInfo& undo)
+{
+	int side = m_nSide;
+	int from = MoveFrom(m);
+	int to = MoveTo(m);
+
+	assert(m_bbSide[side] & SqBB(from));
+
+	// remove a captured enemy piece
+	undo.nCaptured = TYPE_NONE;
+	if (m_bbSide[side ^ 1] & SqBB(to))
+	{
+		undo.nCaptured = GetTypeAt(to);
+		RemovePiece(side ^ 1, undo.nCaptured, to);
+	}
+
+	undo.nMoved = GetTypeAt(from);
+	MovePiece(side, undo.nMoved, from, to);
+	FlipSide();
+
+#ifdef CHESS_DEBUG_POSITION
+	Verify();
+#endif
+}
+
+/// @brief		take back a move played by MakeMove()
+/// @param		m [in] the move given to MakeMove()
+/// @param		undo [in] information filled by MakeMove()
+/// @return		void
+void
+CPosition::UnmakeMove(const Move m, const SUndoInfo& undo)
+{
+	FlipSide();
+
+	int side = m_nSide;
+	int from = MoveFrom(m);
+	int to = MoveTo(m);
+
+	MovePiece(side, undo.nMoved, to, from);
+
+	// put the captured enemy piece back
+	if (undo.nCaptured != TYPE_NONE)
+		PutPiece(side ^ 1, undo.nCaptured, to);
+
+#ifdef CHESS_DEBUG_POSITION
+	Verify();
+#endif
+}
+
+/// @brief		compute the Zobrist key from scratch
+/// @param		N/A
+/// @return		key of the pieces on their squares and the side to move
+uint64_t
+CPosition::ComputeKey() const
+{
+	uint64_t nKey = (m_nSide == SIDE_BLACK) ? s_nZobristSide : 0;
+
+	for (int side = 0; side < SIDE_NB; side++)
+	{
+		for (int type = 0; type < TYPE_NB; type++)
+		{
+			for (Bitboard bb = m_bbPieces[side][type]; bb; )
+				nKey ^= s_arrZobristPiece[side][type][PopLsb(bb)];
+		}
+	}
+
+	return nKey;
+}
+
+/// @brief		compute the material and square bonus from scratch
+/// @param		N/A
+/// @return		sum of g_arrPsq over the pieces (white's point of view)
+int
+CPosition::ComputePsq() const
+{
+	int nPsq = 0;
+
+	for (int idx = 0; idx < m_nPieceCount; idx++)
+		nPsq += g_arrPsq[m_arrPieceSide[idx]][m_arrPieceType[idx]][m_arrPieceSq[idx]];
+
+	return nPsq;
+}
+
+/// @brief		check the incrementally kept state against a full recomputation
+/// @param		N/A
+/// @return		void
+/// @remark		aborts on a mismatch (also in release builds, unlike assert)
+void
+CPosition::Verify() const
+{
+	if (m_nKey != ComputeKey())
+	{
+		fprintf(stderr, "CPosition::Verify: Zobrist key %016llx != %016llx\n", \
+			(unsigned long long)m_nKey, (unsigned long long)ComputeKey());
+		abort();
+	}
+
+	if (m_nPsq != ComputePsq())
+	{
+		fprintf(stderr, "CPosition::Verify: evaluation %d != %d\n", m_nPsq, ComputePsq());
+		abort();
+	}
+
+	// every listed piece is on its bitboards, and every occupied square is listed
+	for (int idx = 0; idx < m_nPieceCount; idx++)
+	{
+		int sq = m_arrPieceSq[idx];
+		if (m_arrSqIndex[sq] != idx || \
+			!(m_bbPieces[m_arrPieceSide[idx]][m_arrPieceType[idx]] & SqBB(sq)))
+		{
+			fprintf(stderr, "CPosition::Verify: piece list entry %d (square %d) is stale\n", idx, sq);
+			abort();
+		}
+	}
+
+	for (int sq = 0; sq < SQUARE_NB; sq++)
+	{
+		if ((m_arrSqIndex[sq] != PIECE_NONE) != ((m_bbOccupied & SqBB(sq)) != 0))
+		{
+			fprintf(stderr, "CPosition::Verify: piece list does not match square %d\n", sq);
+			abort();
+		}
+	}
+}
+
+/// @brief		side of the piece on a square
+/// @param		sq [in] square index
+/// @return		SIDE_WHITE, SIDE_BLACK, or -1 if the square is vacant
+int
+CPosition::GetSideAt(const int sq) const
+{
+	int idx = m_arrSqIndex[sq];
+	return (idx == PIECE_NONE) ? -1 : m_arrPieceSide[idx];
+}
+
+/// @brief		type of the piece on a square
+/// @param		sq [in] square index
+/// @return		TYPE_KING, TYPE_ROOK, TYPE_BISH, TYPE_PAWN, or TYPE_NONE if vacant
+int
+CPosition::GetTypeAt(const int sq) const
+{
+	int idx = m_arrSqIndex[sq];
+	return (idx == PIECE_NONE) ? int(TYPE_NONE) : int(m_arrPieceType[idx]);
+}
+
+/// @brief		squares where the piece on sq can move (pseudo-legal, see CChessPiece classes)
+/// @param		sq [in] square index of a piece
+/// @return		destination squares (0 if the square is vacant)
+Bitboard
+CPosition::GetTargets(const int sq) const
+{
+	int side = GetSideAt(sq);
+	if (side < 0)
+		return 0;
+
+	// dispatch once to the compile-time specialized rule of the piece
+	switch (GetTypeAt(sq) * SIDE_NB + side)
+	{
+	case TYPE_KING * SIDE_NB + SIDE_WHITE:	return GetPieceTargets<TYPE_KING, SIDE_WHITE>(*this, sq);
+	case TYPE_KING * SIDE_NB + SIDE_BLACK:	return GetPieceTargets<TYPE_KING, SIDE_BLACK>(*this, sq);
+	case TYPE_ROOK * SIDE_NB + SIDE_WHITE:	return GetPieceTargets<TYPE_ROOK, SIDE_WHITE>(*this, sq);
+	case TYPE_ROOK * SIDE_NB + SIDE_BLACK:	return GetPieceTargets<TYPE_ROOK, SIDE_BLACK>(*this, sq);
+	case TYPE_BISH * SIDE_NB + SIDE_WHITE:	return GetPieceTargets<TYPE_BISH, SIDE_WHITE>(*this, sq);
+	case TYPE_BISH * SIDE_NB + SIDE_BLACK:	return GetPieceTargets<TYPE_BISH, SIDE_BLACK>(*this, sq);
+	case TYPE_PAWN * SIDE_NB + SIDE_WHITE:	return GetPieceTargets<TYPE_PAWN, SIDE_WHITE>(*this, sq);
+	case TYPE_PAWN * SIDE_NB + SIDE_BLACK:
+	default:								return GetPieceTargets<TYPE_PAWN, SIDE_BLACK>(*this, sq);
+	}
+}
+
+/// @brief		all squares attacked by the pieces of a side
+/// @param		side [in] SIDE_WHITE or SIDE_BLACK
+/// @return		attacked squares (occupied squares are included)
+Bitboard
+CPosition::GetAttacks(const int side) const
+{
+	Bitboard bbAttacks = 0;
+	Bitboard bb;
+
+	// pawns attack diagonally forward, all at once
+	Bitboard bbPawns = m_bbPieces[side][TYPE_PAWN];
+	Bitboard bbPawnsFwd = (side == SIDE_WHITE) ? ShiftUp(bbPawns) : ShiftDown(bbPawns);
+	bbAttacks |= ((bbPawnsFwd & ~BB_FILE_A) >> 1) | ((bbPawnsFwd & ~BB_FILE_H) << 1);
+
+	for (bb = m_bbPieces[side][TYPE_KING]; bb; )
+		bbAttacks |= GetKingAttacks(PopLsb(bb));
+
+	for (bb = m_bbPieces[side][TYPE_ROOK]; bb; )
+		bbAttacks |= GetRookAttacks(PopLsb(bb), m_bbOccupied);
+
+	for (bb = m_bbPieces[side][TYPE_BISH]; bb; )
+		bbAttacks |= GetBishAttacks(PopLsb(bb), m_bbOccupied);
+
+	return bbAttacks;
+}
+
+/// @brief		pieces of both sides which attack a square
+/// @param		sq [in] square index
+/// @param		bbOccupied [in] occupancy for the sliding pieces (eg. without a piece which moves away)
+/// @return		attacking pieces
+Bitboard
+CPosition::GetAttackersTo(const int sq, const Bitboard bbOccupied) const
+{
+	return (GetPawnAttacks(SIDE_BLACK, sq) & m_bbPieces[SIDE_WHITE][TYPE_PAWN]) \
+		| (GetPawnAttacks(SIDE_WHITE, sq) & m_bbPieces[SIDE_BLACK][TYPE_PAWN]) \
+		| (GetKingAttacks(sq) & (m_bbPieces[SIDE_WHITE][TYPE_KING] | m_bbPieces[SIDE_BLACK][TYPE_KING])) \
+		| (GetRookAttacks(sq, bbOccupied) & (m_bbPieces[SIDE_WHITE][TYPE_ROOK] | m_bbPieces[SIDE_BLACK][TYPE_ROOK])) \
+		| (GetBishAttacks(sq, bbOccupied) & (m_bbPieces[SIDE_WHITE][TYPE_BISH] | m_bbPieces[SIDE_BLACK][TYPE_BISH]));
+}
+
+/// @brief		check whether a square is attacked by a side
+/// @param		sq [in] square index
+/// @param		bySide [in] attacking side
+/// @return		true if any piece of bySide attacks the square, otherwise false
+/// @remark		probes outward from the square with each piece's own attack pattern,
+///				so it's the same as testing GetAttacks(bySide) without building the map
+bool
+CPosition::IsSquareAttacked(const int sq, const int bySide) const
+{
+	const Bitboard *bbBy = m_bbPieces[bySide];
+
+	// a pawn of bySide attacks sq if a pawn of the other side on sq would attack it
+	if (GetPawnAttacks(bySide ^ 1, sq) & bbBy[TYPE_PAWN])
+		return true;
+
+	if (GetKingAttacks(sq) & bbBy[TYPE_KING])
+		return true;
+
+	if (bbBy[TYPE_ROOK] && (GetRookAttacks(sq, m_bbOccupied) & bbBy[TYPE_ROOK]))
+		return true;
+
+	if (bbBy[TYPE_BISH] && (GetBishAttacks(sq, m_bbOccupied) & bbBy[TYPE_BISH]))
+		return true;
+
+	return false;
+}
+
+/// @brief		check whether the king of a side is attacked
+/// @param		side [in] SIDE_WHITE or SIDE_BLACK
+/// @return		true if the king is attacked, otherwise false (also when there's no king)
+bool
+CPosition::IsInCheck(const int side) const
+{
+	return HasKing(side) && IsSquareAttacked(GetKingSq(side), side ^ 1);
+}
+
+/// @brief		check the 'stalemate' rule of the game (a draw, see CChessBoard::Decide())
+/// @param		N/A
+/// @return		true if every square the king of the side to move can reach is attacked
+///				and no other piece of that side can move, otherwise false
+/// @remark		the king of the side to move must be on the board. The rule is this game's
+///				own: whether the king is attacked where it stands doesn't matter.
+bool
+CPosition::IsStalemate() const
+{
+	int side = GetSide();
+	int enemy = side ^ 1;
+
+	// the cheap tests first (the search asks at every node): a pawn which can push
+	Bitboard bbPawns = m_bbPieces[side][TYPE_PAWN];
+	Bitboard bbPush = (side == SIDE_WHITE) ? ShiftUp(bbPawns) : ShiftDown(bbPawns);
+	if (bbPush & ~m_bbOccupied)
+		return false;
+
+	// if it is possible to move at least one piece other than the king, it's not 'statemate'
+	Bitboard bbOthers = m_bbSide[side] & ~m_bbPieces[side][TYPE_KING];
+	while (bbOthers)
+	{
+		if (GetTargets(PopLsb(bbOthers)))
+			return false;
+	}
+
+	// check if the king can avoid: one of its possible positions is not attacked by any enemy
+	Bitboard bbKingTargets = GetKingAttacks(GetKingSq(side)) & ~m_bbSide[side];
+	while (bbKingTargets)
+	{
+		if (!IsSquareAttacked(PopLsb(bbKingTargets), enemy))
+			return false;
+	}
+
+	return true;
+}
@@ -0,0 +1,128 @@
+///
+/// @file		Position.h
+/// @author		Junpyo Hong (jp7.hong@gmail.com)
+/// @date		Oct. 18, 2026
+/// @version	1.0
+/// @brief		bitboard position (authoritative state of the chessboard)
+/// @remark		Tab size: 4
+///
+
+#ifndef _POSITION_H_
+#define _POSITION_H_
+
+#include "Bitboard.h"
+#include "Move.h"
+
+/// side index used by the bitboard arrays
+enum ESide { SIDE_WHITE = 0, SIDE_BLACK, SIDE_NB };
+
+/// piece type index used by the bitboard arrays
+enum EPieceType { TYPE_KING = 0, TYPE_ROOK, TYPE_BISH, TYPE_PAWN, TYPE_NB, TYPE_NONE = TYPE_NB };
+
+/// @brief		'W' or 'B' of a side index
+inline char SideToColor(const int side) { return (side == SIDE_WHITE) ? 'W' : 'B'; }
+
+/// @brief		side index of 'W' or 'B' (-1 for any other character)
+inline int
+ColorToSide(const char color)
+{
+	return (color == 'W') ? SIDE_WHITE : (color == 'B') ? SIDE_BLACK : -1;
+}
+
+/// @brief		'K', 'R', 'B', or 'P' of a piece type index
+inline char TypeToName(const int type) { return "KRBP."[type]; }
+
+/// @brief		piece type index of 'K', 'R', 'B', or 'P' (TYPE_NONE for any other character)
+inline int
+NameToType(const char name)
+{
+	switch (name)
+	{
+	case 'K': return TYPE_KING;
+	case 'R': return TYPE_ROOK;
+	case 'B': return TYPE_BISH;
+	case 'P': return TYPE_PAWN;
+	default:  return TYPE_NONE;
+	}
+}
+
+/// capacity of the piece list of CPosition: a game starts with 26 pieces (13 a side) and never
+/// gains one (pawns don't promote), the rest is room for SetFen() positions (more are rejected)
+const int PIECE_MAX = 32;
+
+/// piece list index of a vacant square
+const uint8_t PIECE_NONE = 0xFF;
+
+/// size of a buffer for CPosition::GetFen() (64 pieces, 7 slashes, side to move, and '\0')
+const int FEN_MAX = 80;
+
+/// @brief		what MakeMove() changed, so that UnmakeMove() can restore it
+struct SUndoInfo
+{
+	int nMoved;			///< type of the moved piece
+	int nCaptured;		///< type of the captured piece (TYPE_NONE if nothing was captured)
+};
+
+/// @brief		bitboard position (authoritative state of the chessboard)
+/// @remark		the pieces are also kept in a struct-of-arrays list inside the object, so a
+///				position has no heap storage and copying it is a plain memberwise copy
+class CPosition
+{
+public:
+	explicit CPosition() { Clear(); }
+
+	void Clear();
+	void SetStartPos();
+	bool SetFen(const char *szFen);
+	int GetFen(char *szFen) const;
+	void PutPiece(const int side, const int type, const int sq);
+	void RemovePiece(const int side, const int type, const int sq);
+	void MovePiece(const int side, const int type, const int from, const int to);
+	void FlipSide();
+	void MakeMove(const Move m, SUndoInfo& undo);
+	void UnmakeMove(const Move m, const SUndoInfo& undo);
+
+	int GetSide() const { return m_nSide; }
+	uint64_t GetKey() const { return m_nKey; }
+	uint64_t ComputeKey() const;
+	int GetPsq() const { return m_nPsq; }
+	int ComputePsq() const;
+	void Verify() const;
+	Bitboard GetPieces(const int side, const int type) const { return m_bbPieces[side][type]; }
+	Bitboard GetSideBB(const int side) const { return m_bbSide[side]; }
+	Bitboard GetOccupied() const { return m_bbOccupied; }
+	bool HasKing(const int side) const { return m_bbPieces[side][TYPE_KING] != 0; }
+	int GetKingSq(const int side) const { return Lsb(m_bbPieces[side][TYPE_KING]); }
+
+	int GetPieceCount() const { return m_nPieceCount; }
+	int GetPieceSq(const int idx) const { return m_arrPieceSq[idx]; }
+	int GetPieceType(const int idx) const { return m_arrPieceType[idx]; }
+	int GetPieceSide(const int idx) const { return m_arrPieceSide[idx]; }
+
+	int GetSideAt(const int sq) const;
+	int GetTypeAt(const int sq) const;
+
+	Bitboard GetTargets(const int sq) const;
+	Bitboard GetAttacks(const int side) const;
+	Bitboard GetAttackersTo(const int sq, const Bitboard bbOccupied) const;
+	bool IsSquareAttacked(const int sq, const int bySide) const;
+	bool IsInCheck(const int side) const;
+	bool IsStalemate() const;
+
+private:
+	Bitboard m_bbPieces[SIDE_NB][TYPE_NB];	///< pieces of each side and type
+	Bitboard m_bbSide[SIDE_NB];				///< all pieces of each side
+	Bitboard m_bbOccupied;					///< all pieces on the board
+	int m_nSide;							///< side to move (SIDE_WHITE or SIDE_BLACK)
+	uint64_t m_nKey;						///< Zobrist key (pieces on squares and side to move)
+	int m_nPsq;								///< material and square bonus for white (see Eval.h)
+
+	// piece list: entries [0, m_nPieceCount) are the pieces on the board in no particular order
+	uint8_t m_arrPieceSq[PIECE_MAX];		///< square of each piece
+	uint8_t m_arrPieceType[PIECE_MAX];		///< type of each piece
+	uint8_t m_arrPieceSide[PIECE_MAX];		///< side of each piece
+	uint8_t m_arrSqIndex[SQUARE_NB];		///< piece list index of each square (PIECE_NONE if vacant)
+	int m_nPieceCount;						///< number of pieces on the board
+};
+
+#endif // _POSITION_H_
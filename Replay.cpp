@@ -0,0 +1,477 @@
+///
+/// @file		Replay.cpp
+/// @author		Junpyo Hong (jp7.hong@gmail.com)
+/// @date		Oct. 18, 2026
+/// @version	1.0
+/// @brief		batch replay of recorded games (text lines or a binary archive, one result per game)
+/// @remark		Tab size: 4
+///
+
+#include <chrono>		// std::chrono::steady_clock
+#include <iostream>		// std::cerr
+#include <cstring>		// memchr
+#include <string>		// std::string
+#include <vector>		// std::vector
+#include <deque>		// std::deque
+#include <map>			// std::map
+#include <algorithm>	// std::min
+#include <thread>		// std::thread
+#include <mutex>		// std::mutex, std::unique_lock
+#include <condition_variable>	// std::condition_variable
+
+#include "Replay.h"
+#include "ChessBoard.h"
+#include "MappedFile.h"
+#include "GameArchive.h"
+#include "Instrument.h"
+
+namespace
+{
+	/// input bytes of a batch (a batch ends at the first line break after this size)
+	const size_t BATCH_BYTES = 1 << 18;
+
+	/// games of a batch of an archive input
+	const uint64_t ARCHIVE_BATCH_GAMES = 4096;
+
+	/// batches which may be read but not yet written, per worker
+	const size_t BATCHES_PER_WORKER = 4;
+
+	/// @brief		whole lines (or archive games) of the input and their result lines
+	struct SReplayBatch
+	{
+		uint64_t nSeq;				///< position of the batch in the input
+		const char *pBegin;			///< first character of the first game (text input)
+		const char *pEnd;			///< one past the last line break or the end (text input)
+		uint64_t nFirstGame;		///< first game (archive input)
+		uint64_t nEndGame;			///< one past the last game (archive input)
+		std::string sOut;			///< result lines
+		uint64_t nGames;			///< the number of games
+		uint64_t nMoves;			///< the number of legal moves played
+		uint64_t nIllegal;			///< the number of games with an illegal move
+	};
+
+	/// @brief		find the end of the batch which begins at p
+	inline const char*
+	NextBatchEnd(const char *p, const char *pEnd)
+	{
+		if (size_t(pEnd - p) <= BATCH_BYTES)
+			return pEnd;
+
+		const char *pEol = static_cast<const char*>(memchr(p + BATCH_BYTES, '\n', size_t(pEnd - p) - BATCH_BYTES));
+		return pEol ? pEol + 1 : pEnd;
+	}
+
+	/// @brief		map a decision of CChessBoard to its result code
+	inline char
+	DecisionCode(const int nDecision)
+	{
+		switch (nDecision)
+		{
+		case CChessBoard::WIN_W:	return 'W';
+		case CChessBoard::WIN_B:	return 'B';
+		case CChessBoard::DRAW:		return 'D';
+		default:					return '*';
+		}
+	}
+
+	/// @brief		play a recorded move if the rules of the interactive game allow it
+	/// @param		pos [in,out] position
+	/// @param		nDecision [in,out] decision on pos (CChessBoard::Decide())
+	/// @param		from [in] source square
+	/// @param		to [in] destination square
+	/// @return		true if the move was played, false if it's illegal
+	inline bool
+	PlayRecordedMove(CPosition& pos, int& nDecision, const int from, const int to)
+	{
+		// the same tests as CChessBoard::GetInput() and CheckMoveRule(), after the end of the game too
+		if (nDecision != CChessBoard::CONTINUE || pos.GetSideAt(from) != pos.GetSide() \
+			|| !(pos.GetTargets(from) & SqBB(to)))
+			return false;
+
+		SUndoInfo undo;
+		pos.MakeMove(PackMove(from, to, pos.GetSideAt(to) >= 0 ? MOVE_CAPTURE : MOVE_QUIET), undo);
+		nDecision = CChessBoard::Decide(pos);
+		return true;
+	}
+
+	/// @brief		append the result line of a game to a batch
+	inline void
+	AddResult(SReplayBatch& batch, const SReplayResult& result)
+	{
+		INSTRUMENT_SCOPE(CNT_OUTPUT);
+
+		char sz[16];
+		batch.sOut.append(sz, size_t(FormatReplayResult(result, sz)));
+		batch.sOut.push_back('\n');
+
+		batch.nGames++;
+		batch.nMoves += uint64_t(result.nMoves);
+		batch.nIllegal += (result.cCode == 'X') ? 1 : 0;
+	}
+
+	/// @brief		replay every game of a batch into its result lines
+	void
+	ReplayBatch(const CPosition& posStart, const CGameArchive *pArchive, SReplayBatch& batch)
+	{
+		SReplayResult result;
+
+		batch.sOut.clear();
+		batch.nGames = batch.nMoves = batch.nIllegal = 0;
+
+		if (pArchive)
+		{
+			for (uint64_t i = batch.nFirstGame; i < batch.nEndGame; i++)
+			{
+				uint32_t nMoves;
+				const uint16_t *pMoves = pArchive->GetMoves(i, nMoves);
+				ReplayGame(posStart, pMoves, nMoves, result);
+				AddResult(batch, result);
+			}
+			return;
+		}
+
+		for (const char *p = batch.pBegin; p < batch.pEnd; )
+		{
+			const char *pEol = static_cast<const char*>(memchr(p, '\n', size_t(batch.pEnd - p)));
+			if (!pEol)
+				pEol = batch.pEnd;
+
+			ReplayGame(posStart, p, pEol, result);
+			AddResult(batch, result);
+			p = pEol + 1;
+		}
+	}
+
+	/// @brief		reader -> workers -> ordered writer over the batches of an input
+	/// @remark		the reader cuts the input into batches of whole lines, each worker replays
+	///				a batch on its own position, and the writer (the calling thread) writes
+	///				the results in input order. at most BATCHES_PER_WORKER batches per
+	///				worker are in flight, so memory stays bounded for any input size.
+	class CReplayPipeline
+	{
+	public:
+		explicit CReplayPipeline(const char *pData, const size_t nSize, const CGameArchive *pArchive,
+			const int nWorkers)
+		: m_pData(pData), m_pDataEnd(pData + nSize), m_pArchive(pArchive), m_nWorkers(nWorkers), \
+			m_nMaxInFlight(BATCHES_PER_WORKER * size_t(nWorkers)), m_nInFlight(0), \
+			m_nBatches(0), m_bReadDone(false)
+		{
+			m_posStart.SetStartPos();
+		}
+
+		void Run(std::ostream& os, SReplayBatch& total);
+
+	private:
+		void Read();
+		void Work();
+
+	private:
+		/// non construction-copyable
+		CReplayPipeline(const CReplayPipeline&);
+
+		/// non copyable
+		const CReplayPipeline& operator=(const CReplayPipeline&);
+
+	private:
+		const char *m_pData;							///< first character of the input
+		const char *m_pDataEnd;							///< one past the last character of the input
+		const CGameArchive *m_pArchive;					///< view of the input if it's an archive (otherwise 0)
+		const int m_nWorkers;							///< the number of worker threads
+		const size_t m_nMaxInFlight;					///< limit of batches read but not yet written
+		CPosition m_posStart;							///< initial position of every game
+		std::mutex m_mutex;								///< guards every member below
+		std::condition_variable m_cvWork;				///< signalled when m_qWork gets a batch or reading ends
+		std::condition_variable m_cvDone;				///< signalled when m_mapDone gets a batch
+		std::condition_variable m_cvSpace;				///< signalled when a batch has been written
+		std::deque<SReplayBatch*> m_qWork;				///< batches waiting for a worker
+		std::map<uint64_t, SReplayBatch*> m_mapDone;	///< replayed batches waiting for their turn
+		size_t m_nInFlight;								///< batches read but not yet written
+		uint64_t m_nBatches;							///< batches read so far
+		bool m_bReadDone;								///< true when the reader has cut the whole input
+	};
+
+	/// @brief		reader stage: cut the input into batches of whole lines (or archive games)
+	void
+	CReplayPipeline::Read()
+	{
+		uint64_t nGames = m_pArchive ? m_pArchive->GetGames() : 0;
+		const char *p = m_pArchive ? m_pDataEnd : m_pData;
+
+		for (uint64_t nGame = 0; nGame < nGames || p < m_pDataEnd; )
+		{
+			SReplayBatch *pBatch = new SReplayBatch;
+			if (m_pArchive)
+			{
+				pBatch->nFirstGame = nGame;
+				pBatch->nEndGame = nGame = std::min(nGame + ARCHIVE_BATCH_GAMES, nGames);
+			}
+			else
+			{
+				pBatch->pBegin = p;
+				pBatch->pEnd = p = NextBatchEnd(p, m_pDataEnd);
+			}
+
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_cvSpace.wait(lock, [this]() { return m_nInFlight < m_nMaxInFlight; });
+			pBatch->nSeq = m_nBatches++;
+			m_nInFlight++;
+			m_qWork.push_back(pBatch);
+			m_cvWork.notify_one();
+		}
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_bReadDone = true;
+		m_cvWork.notify_all();
+		m_cvDone.notify_all();
+	}
+
+	/// @brief		worker stage: replay batches until the reader is done and the queue is empty
+	void
+	CReplayPipeline::Work()
+	{
+		CPosition posStart = m_posStart;
+
+		for (;;)
+		{
+			SReplayBatch *pBatch;
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_cvWork.wait(lock, [this]() { return !m_qWork.empty() || m_bReadDone; });
+				if (m_qWork.empty())
+					return;
+				pBatch = m_qWork.front();
+				m_qWork.pop_front();
+			}
+
+			ReplayBatch(posStart, m_pArchive, *pBatch);
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_mapDone[pBatch->nSeq] = pBatch;
+			m_cvDone.notify_one();
+		}
+	}
+
+	/// @brief		run the pipeline; the calling thread is the ordered writer
+	/// @param		os [in] output stream of the results
+	/// @param		total [out] summed counts of every batch
+	void
+	CReplayPipeline::Run(std::ostream& os, SReplayBatch& total)
+	{
+		total.nGames = total.nMoves = total.nIllegal = 0;
+
+		std::vector<std::thread> vThread;
+		vThread.push_back(std::thread(&CReplayPipeline::Read, this));
+		for (int i = 0; i < m_nWorkers; i++)
+			vThread.push_back(std::thread(&CReplayPipeline::Work, this));
+
+		for (uint64_t nNext = 0; ; nNext++)
+		{
+			SReplayBatch *pBatch;
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_cvDone.wait(lock, [this, nNext]()
+				{
+					return m_mapDone.count(nNext) || (m_bReadDone && nNext == m_nBatches);
+				});
+				if (!m_mapDone.count(nNext))
+					break;
+				pBatch = m_mapDone[nNext];
+				m_mapDone.erase(nNext);
+			}
+
+			os.write(pBatch->sOut.data(), std::streamsize(pBatch->sOut.size()));
+			total.nGames += pBatch->nGames;
+			total.nMoves += pBatch->nMoves;
+			total.nIllegal += pBatch->nIllegal;
+			delete pBatch;
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_nInFlight--;
+			m_cvSpace.notify_one();
+		}
+
+		for (size_t i = 0; i < vThread.size(); i++)
+			vThread[i].join();
+	}
+}
+
+/// @brief		replay one game with the rules of the interactive game
+/// @param		posStart [in] initial position
+/// @param		p [in] first character of the moves (eg. "E2,E3 D7,D6")
+/// @param		pEnd [in] one past the last character of the moves
+/// @param		result [out] result of the game
+/// @return		void
+/// @remark		a move is illegal if it's malformed, doesn't move a piece of the side to move
+///				to one of its target squares, or comes after the end of the game
+void
+ReplayGame(const CPosition& posStart, const char *p, const char *pEnd, SReplayResult& result)
+{
+	CPosition pos = posStart;
+	int nDecision = CChessBoard::Decide(pos);
+	int from, to, nRet;
+
+	result.nMoves = 0;
+	result.nIllegal = 0;
+
+	for (;;)
+	{
+		{
+			INSTRUMENT_SCOPE(CNT_INPUT);
+			nRet = ParseMoveToken(p, pEnd, from, to);
+		}
+
+		if (nRet == 0)
+			break;
+		if (nRet < 0 || !PlayRecordedMove(pos, nDecision, from, to))
+		{
+			result.cCode = 'X';
+			result.nIllegal = result.nMoves + 1;
+			return;
+		}
+
+		result.nMoves++;
+	}
+
+	result.cCode = DecisionCode(nDecision);
+}
+
+/// @brief		replay one game of an archive with the rules of the interactive game
+/// @param		posStart [in] initial position
+/// @param		pMoves [in] moves of the game (see CGameArchive)
+/// @param		nMoves [in] the number of moves
+/// @param		result [out] result of the game
+/// @return		void
+void
+ReplayGame(const CPosition& posStart, const uint16_t *pMoves, const uint32_t nMoves, SReplayResult& result)
+{
+	CPosition pos = posStart;
+	int nDecision = CChessBoard::Decide(pos);
+
+	result.nMoves = 0;
+	result.nIllegal = 0;
+
+	for (uint32_t i = 0; i < nMoves; i++)
+	{
+		Move m = Move(pMoves[i]);
+		if (m == ARCHIVE_MOVE_BAD || !PlayRecordedMove(pos, nDecision, MoveFrom(m), MoveTo(m)))
+		{
+			result.cCode = 'X';
+			result.nIllegal = result.nMoves + 1;
+			return;
+		}
+
+		result.nMoves++;
+	}
+
+	result.cCode = DecisionCode(nDecision);
+}
+
+/// @brief		write the result line of a game (without the line break)
+/// @param		result [in] result of a game
+/// @param		sz [out] text such as "W" or "X 12" (at least 16 characters)
+/// @return		length of the text
+int
+FormatReplayResult(const SReplayResult& result, char *sz)
+{
+	int n = 0;
+	sz[n++] = result.cCode;
+
+	if (result.cCode == 'X')
+	{
+		char szDigits[12];
+		int nDigits = 0;
+		for (int v = result.nIllegal; nDigits == 0 || v > 0; v /= 10)
+			szDigits[nDigits++] = char('0' + v % 10);
+
+		sz[n++] = ' ';
+		while (nDigits > 0)
+			sz[n++] = szDigits[--nDigits];
+	}
+
+	sz[n] = 0;
+	return n;
+}
+
+/// @brief		replay every game of a file and write one result line per game
+/// @param		szPath [in] path of the games or of an archive ("-" for the standard input)
+/// @param		os [in] output stream of the results
+/// @param		nThreads [in] the number of worker threads (1 replays on the calling thread)
+/// @return		true if the file was read, otherwise false
+/// @remark		each line is a game of moves from the initial position (eg. "E2,E3 D7,D6").
+///				results are in input order for any nThreads. a summary goes to std::cerr
+///				so that os has only the result lines.
+bool
+RunReplay(const char *szPath, std::ostream& os, const int nThreads)
+{
+	CMappedFile file;
+	if (!file.Open(szPath))
+	{
+		std::cerr << "cannot read " << szPath << std::endl;
+		return false;
+	}
+
+	// a binary archive (see ConvertGameText()) is replayed from its mapping without parsing
+	CGameArchive archive;
+	const CGameArchive *pArchive = 0;
+	if (CGameArchive::IsArchive(file.GetData(), file.GetSize()))
+	{
+		if (!archive.Attach(file.GetData(), file.GetSize()))
+		{
+			std::cerr << "broken game archive " << szPath << std::endl;
+			return false;
+		}
+		pArchive = &archive;
+	}
+
+	std::chrono::steady_clock::time_point tBegin = std::chrono::steady_clock::now();
+
+	SReplayBatch total;
+	if (nThreads > 1)
+	{
+		CReplayPipeline pipeline(file.GetData(), file.GetSize(), pArchive, nThreads);
+		pipeline.Run(os, total);
+	}
+	else
+	{
+		CPosition posStart;
+		posStart.SetStartPos();
+
+		total.nGames = total.nMoves = total.nIllegal = 0;
+
+		SReplayBatch batch;
+		uint64_t nGames = pArchive ? pArchive->GetGames() : 0;
+		const char *pEnd = file.GetData() + file.GetSize();
+		batch.pBegin = batch.pEnd = pArchive ? pEnd : file.GetData();
+		batch.nEndGame = 0;
+
+		for (batch.nFirstGame = 0; batch.nFirstGame < nGames || batch.pBegin < pEnd; )
+		{
+			if (pArchive)
+				batch.nEndGame = std::min(batch.nFirstGame + ARCHIVE_BATCH_GAMES, nGames);
+			else
+				batch.pEnd = NextBatchEnd(batch.pBegin, pEnd);
+
+			ReplayBatch(posStart, pArchive, batch);
+
+			os.write(batch.sOut.data(), std::streamsize(batch.sOut.size()));
+			total.nGames += batch.nGames;
+			total.nMoves += batch.nMoves;
+			total.nIllegal += batch.nIllegal;
+
+			batch.nFirstGame = batch.nEndGame;
+			batch.pBegin = batch.pEnd;
+		}
+	}
+	os.flush();
+
+	double dSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - tBegin).count();
+	if (dSec <= 0)
+		dSec = 1e-9;
+
+	std::cerr << "games " << total.nGames << " moves " << total.nMoves << " illegal " << total.nIllegal \
+		<< " threads " << nThreads << " time " << uint64_t(dSec * 1000) << " ms" \
+		<< " games/s " << uint64_t(total.nGames / dSec) \
+		<< " moves/s " << uint64_t(total.nMoves / dSec) << std::endl;
+
+	return true;
+}
@@ -0,0 +1,31 @@
+///
+/// @file		Replay.h
+/// @author		Junpyo Hong (jp7.hong@gmail.com)
+/// @date		Oct. 18, 2026
+/// @version	1.0
+/// @brief		batch replay of recorded games (text lines or a binary archive, one result per game)
+/// @remark		Tab size: 4
+///
+
+#ifndef _REPLAY_H_
+#define _REPLAY_H_
+
+#include <ostream>		// std::ostream
+#include <cstdint>		// uint16_t, uint32_t
+
+#include "Position.h"
+
+/// @brief		result of a replayed game
+struct SReplayResult
+{
+	char cCode;			///< 'W' or 'B' (winner), 'D' (draw), '*' (not finished), or 'X' (illegal move)
+	int nMoves;			///< the number of moves played (the illegal move excluded)
+	int nIllegal;		///< 1-based index of the first illegal move (0 if every move is legal)
+};
+
+void ReplayGame(const CPosition& posStart, const char *p, const char *pEnd, SReplayResult& result);
+void ReplayGame(const CPosition& posStart, const uint16_t *pMoves, const uint32_t nMoves, SReplayResult& result);
+int FormatReplayResult(const SReplayResult& result, char *sz);
+bool RunReplay(const char *szPath, std::ostream& os, const int nThreads = 1);
+
+#endif // _REPLAY_H_
@@ -0,0 +1,366 @@
+///
+/// @file		Search.cpp
+/// @author		Junpyo Hong (jp7.hong@gmail.com)
+/// @date		Oct. 18, 2026
+/// @version	1.0
+/// @brief		alpha-beta search with iterative deepening
+/// @remark		Tab size: 4
+///
+
+#include "Search.h"
+#include "MoveGen.h"
+#include "MovePick.h"
+#include "Eval.h"
+
+namespace
+{
+	/// helper threads skip some iterations so that they spread over different depths
+	const int s_arrSkipSize[]  = { 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4 };
+	const int s_arrSkipPhase[] = { 0, 1, 0, 1, 2, 3, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 6, 7 };
+	const int SKIP_PATTERNS = int(sizeof(s_arrSkipSize) / sizeof(s_arrSkipSize[0]));
+}
+
+/// @brief		join a thread group which shares a stop request (see CSmpSearch)
+/// @param		pSharedStop [in] stop request of the group (0 to leave the group)
+/// @param		nThreadIdx [in] 0 for the main thread, >0 for helpers
+/// @return		void
+void
+CSearch::SetShared(std::atomic<bool> *pSharedStop, const int nThreadIdx)
+{
+	m_pSharedStop = pSharedStop;
+	m_nThreadIdx = nThreadIdx;
+}
+
+/// @brief		search a position until a limit is reached
+/// @param		pos [in] root position
+/// @param		limits [in] depth, time, and node limits (at least depth 1 is searched)
+/// @param		pOs [in] stream for one info line per iteration (0 for none)
+/// @return		best move, score, principal variation, and statistics
+/// @remark		the table's age isn't advanced here (threads share the table): the owner of
+///				the search calls CTransTable::NewSearch() once before it (see CSmpSearch::Go())
+SSearchResult
+CSearch::Go(const CPosition& pos, const SSearchLimits& limits, std::ostream *pOs)
+{
+	SSearchResult result;
+	result.bestMove = MOVE_NONE;
+	result.nScore = 0;
+	result.nDepth = 0;
+	result.nPvLen = 0;
+
+	m_pos = pos;
+	m_limits = limits;
+	m_pOs = pOs;
+	m_tBegin = std::chrono::steady_clock::now();
+	m_nNodes = 0;
+	m_bStop = false;
+	m_nPrevPvLen = 0;
+	m_ttStats = STTStats();
+
+	for (int ply = 0; ply < MAX_PLY; ply++)
+		for (int i = 0; i < KILLER_NB; i++)
+			m_arrKillers[ply][i] = MOVE_NONE;
+	for (int side = 0; side < SIDE_NB; side++)
+		m_arrHistory[side].Clear();
+
+	if (m_pNnue)
+		m_pNnue->Refresh(m_pos, m_arrAcc[0]);
+
+	int nMaxDepth = (limits.nDepth > 0 && limits.nDepth < MAX_PLY) ? limits.nDepth : MAX_PLY - 1;
+
+	for (int depth = 1; depth <= nMaxDepth; depth++)
+	{
+		// helpers skip depths by their pattern (the main thread searches every depth)
+		if (m_nThreadIdx > 0)
+		{
+			int i = (m_nThreadIdx - 1) % SKIP_PATTERNS;
+			if (((depth + s_arrSkipPhase[i]) / s_arrSkipSize[i]) % 2 != 0)
+				continue;
+
+			if (m_pSharedStop && m_pSharedStop->load(std::memory_order_relaxed))
+				break;
+		}
+
+		// the first iteration of the main thread always completes so that there's a move to play
+		m_bCanStop = (depth > 1 || m_nThreadIdx > 0);
+
+		int score = Negamax(depth, 0, -SCORE_INF, SCORE_INF);
+		if (m_bStop)
+			break;
+
+		result.nScore = score;
+		result.nDepth = depth;
+		result.nPvLen = m_arrPvLen[0];
+		result.bestMove = (m_arrPvLen[0] > 0) ? m_arrPv[0][0] : MOVE_NONE;
+		for (int i = 0; i < m_arrPvLen[0]; i++)
+			result.arrPv[i] = m_arrPrevPv[i] = m_arrPv[0][i];
+		m_nPrevPvLen = m_arrPvLen[0];
+
+		ShowInfo(depth, score);
+
+		// no move, or a forced king capture has been found
+		if (result.bestMove == MOVE_NONE || score >= SCORE_WIN_MIN || score <= -SCORE_WIN_MIN)
+			break;
+	}
+
+	result.nNodes = m_nNodes;
+	result.ttStats = m_ttStats;
+	result.dSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_tBegin).count();
+
+	return result;
+}
+
+/// @brief		negamax alpha-beta search
+/// @param		depth [in] remaining depth in plies
+/// @param		ply [in] distance from the root
+/// @param		alpha [in] lower bound
+/// @param		beta [in] upper bound
+/// @return		score for the side to move
+int
+CSearch::Negamax(int depth, const int ply, int alpha, const int beta)
+{
+	// the horizon: Quiesce() counts the node and makes the end-of-game tests itself
+	if (depth <= 0)
+		return Quiesce(ply, alpha, beta);
+
+	m_arrPvLen[ply] = 0;
+	m_nNodes++;
+
+	// the previous move captured our king: the game is over (sooner is worse)
+	if (!m_pos.HasKing(m_pos.GetSide()))
+		return -(SCORE_WIN - ply);
+
+	// the game calls a draw here even though king moves remain (see CChessBoard::Decide())
+	if (m_pos.IsStalemate())
+		return 0;
+
+	if (ply >= MAX_PLY - 1)
+		return Evaluate(ply);
+
+	if ((m_nNodes & 1023) == 0 && m_bCanStop && IsTimeUp())
+		m_bStop = true;
+
+	if (m_bStop)
+		return 0;
+
+	// a deep enough stored result may decide this node (never at the root, which needs a move)
+	STTData tt;
+	Move firstMove = (ply < m_nPrevPvLen) ? m_arrPrevPv[ply] : MOVE_NONE;
+	if (m_pTT && m_pTT->Probe(m_pos.GetKey(), tt, m_ttStats))
+	{
+		int ttScore = CTransTable::ScoreFromTT(tt.nScore, ply);
+
+		if (ply > 0 && tt.nDepth >= depth && (tt.nBound == BOUND_EXACT \
+			|| (tt.nBound == BOUND_LOWER && ttScore >= beta) \
+			|| (tt.nBound == BOUND_UPPER && ttScore <= alpha)))
+			return ttScore;
+
+		if (tt.move != MOVE_NONE)
+			firstMove = tt.move;
+	}
+
+	int alphaOrig = alpha;
+	int best = -SCORE_INF;
+	Move bestMove = MOVE_NONE;
+	int nMoves = 0;
+	SUndoInfo undo;
+
+	// the stored move (or the move of the previous principal variation) comes first
+	CMovePicker picker(m_pos, firstMove, m_arrKillers[ply], m_arrHistory[m_pos.GetSide()]);
+	for (Move m = picker.Next(); m != MOVE_NONE; m = picker.Next())
+	{
+		nMoves++;
+
+		m_pos.MakeMove(m, undo);
+		if (m_pNnue)
+			m_pNnue->Update(m_arrAcc[ply], m_arrAcc[ply + 1], m_pos, m, undo);
+		int score = -Negamax(depth - 1, ply + 1, -beta, -alpha);
+		m_pos.UnmakeMove(m, undo);
+
+		if (m_bStop)
+			return 0;
+
+		if (score > best)
+		{
+			best = score;
+			bestMove = m;
+
+			if (score > alpha)
+			{
+				alpha = score;
+
+				// this move followed by the child's principal variation
+				m_arrPv[ply][0] = m;
+				for (int j = 0; j < m_arrPvLen[ply + 1]; j++)
+					m_arrPv[ply][j + 1] = m_arrPv[ply + 1][j];
+				m_arrPvLen[ply] = m_arrPvLen[ply + 1] + 1;
+
+				if (alpha >= beta)
+				{
+					if (!IsCapture(m))
+						UpdateQuietStats(ply, depth, m);
+					break;
+				}
+			}
+		}
+	}
+
+	// no piece can move: 'stalemate'
+	if (nMoves == 0)
+		return 0;
+
+	if (m_pTT)
+	{
+		int nBound = (best >= beta) ? BOUND_LOWER : (best > alphaOrig) ? BOUND_EXACT : BOUND_UPPER;
+		m_pTT->Store(m_pos.GetKey(), (nBound == BOUND_UPPER) ? MOVE_NONE : bestMove, \
+			CTransTable::ScoreToTT(best, ply), depth, nBound, m_ttStats);
+	}
+
+	return best;
+}
+
+/// @brief		search captures only until the position is quiet
+/// @param		ply [in] distance from the root
+/// @param		alpha [in] lower bound
+/// @param		beta [in] upper bound
+/// @return		score for the side to move
+/// @remark		the side to move may stand pat (take the static score) instead of capturing,
+///				and captures which lose material by See() aren't searched at all. A king
+///				capture always wins material, so a hanging king is never missed at the horizon.
+int
+CSearch::Quiesce(const int ply, int alpha, const int beta)
+{
+	m_arrPvLen[ply] = 0;
+	m_nNodes++;
+
+	// the previous move captured our king: the game is over (sooner is worse)
+	if (!m_pos.HasKing(m_pos.GetSide()))
+		return -(SCORE_WIN - ply);
+
+	// the game calls a draw here even though king moves remain (see CChessBoard::Decide())
+	if (m_pos.IsStalemate())
+		return 0;
+
+	int best = Evaluate(ply);
+	if (ply >= MAX_PLY - 1 || best >= beta)
+		return best;
+
+	if ((m_nNodes & 1023) == 0 && m_bCanStop && IsTimeUp())
+		m_bStop = true;
+
+	if (m_bStop)
+		return 0;
+
+	if (best > alpha)
+		alpha = best;
+
+	SUndoInfo undo;
+	CMovePicker picker(m_pos);
+	for (Move m = picker.Next(); m != MOVE_NONE; m = picker.Next())
+	{
+		m_pos.MakeMove(m, undo);
+		if (m_pNnue)
+			m_pNnue->Update(m_arrAcc[ply], m_arrAcc[ply + 1], m_pos, m, undo);
+		int score = -Quiesce(ply + 1, -beta, -alpha);
+		m_pos.UnmakeMove(m, undo);
+
+		if (m_bStop)
+			return 0;
+
+		if (score > best)
+		{
+			best = score;
+			if (score > alpha)
+			{
+				alpha = score;
+				if (alpha >= beta)
+					break;
+			}
+		}
+	}
+
+	return best;
+}
+
+/// @brief		remember a quiet move which caused a beta cutoff (killer move and history)
+/// @param		ply [in] distance from the root
+/// @param		depth [in] remaining depth of the node
+/// @param		m [in] the move
+/// @return		void
+void
+CSearch::UpdateQuietStats(const int ply, const int depth, const Move m)
+{
+	if (m_arrKillers[ply][0] != m)
+	{
+		m_arrKillers[ply][1] = m_arrKillers[ply][0];
+		m_arrKillers[ply][0] = m;
+	}
+
+	m_arrHistory[m_pos.GetSide()].Add(m, depth * depth);
+}
+
+/// @brief		static score for the side to move (the network, or material and piece-square tables)
+/// @param		ply [in] distance from the root (selects the network accumulator)
+/// @return		score in centipawns
+int
+CSearch::Evaluate(const int ply) const
+{
+	if (m_pNnue)
+		return m_pNnue->Evaluate(m_arrAcc[ply], m_pos.GetSide());
+
+	return ::Evaluate(m_pos);
+}
+
+/// @brief		check the stop request, time and node limits
+/// @param		N/A
+/// @return		true if the search should stop, otherwise false
+bool
+CSearch::IsTimeUp()
+{
+	if (m_pSharedStop && m_pSharedStop->load(std::memory_order_relaxed))
+		return true;
+
+	if (m_limits.nNodes > 0 && m_nNodes >= m_limits.nNodes)
+		return true;
+
+	if (m_limits.nMoveTimeMs > 0)
+	{
+		std::chrono::duration<double, std::milli> dt = std::chrono::steady_clock::now() - m_tBegin;
+		if (dt.count() >= m_limits.nMoveTimeMs)
+			return true;
+	}
+
+	return false;
+}
+
+/// @brief		show depth, score, nodes, nodes/sec, time, and principal variation
+/// @param		depth [in] completed depth
+/// @param		score [in] score of the iteration
+/// @return		void
+void
+CSearch::ShowInfo(const int depth, const int score)
+{
+	if (!m_pOs)
+		return;
+
+	double dSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_tBegin).count();
+	char szMove[6];
+
+	*m_pOs << "info depth " << depth;
+
+	// king capture in N plies is shown as "win N" (or "loss N")
+	if (score >= SCORE_WIN_MIN)
+		*m_pOs << " score win " << (SCORE_WIN - score);
+	else if (score <= -SCORE_WIN_MIN)
+		*m_pOs << " score loss " << (SCORE_WIN + score);
+	else
+		*m_pOs << " score cp " << score;
+
+	*m_pOs << " nodes " << m_nNodes \
+		<< " nps " << uint64_t(m_nNodes / (dSec > 0 ? dSec : 1e-9)) \
+		<< " time " << uint64_t(dSec * 1000) << " pv";
+
+	for (int i = 0; i < m_arrPvLen[0]; i++)
+		*m_pOs << " " << FormatMove(m_arrPv[0][i], szMove);
+
+	*m_pOs << std::endl;
+}
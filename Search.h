@@ -0,0 +1,106 @@
+///
+/// @file		Search.h
+/// @author		Junpyo Hong (jp7.hong@gmail.com)
+/// @date		Oct. 18, 2026
+/// @version	1.0
+/// @brief		alpha-beta search with iterative deepening
+/// @remark		Tab size: 4
+///
+
+#ifndef _SEARCH_H_
+#define _SEARCH_H_
+
+#include <cstdint>		// uint64_t
+#include <ostream>		// std::ostream
+#include <chrono>		// std::chrono::steady_clock
+#include <atomic>		// std::atomic
+
+#include "Position.h"
+#include "TransTable.h"
+#include "Nnue.h"
+#include "MovePick.h"
+
+/// maximum search depth in plies
+#define MAX_PLY		(64)
+
+/// score of capturing the enemy king (the game is over, see CChessBoard::MakeDecision())
+const int SCORE_WIN = 30000;
+
+/// scores beyond this are king captures within MAX_PLY plies
+const int SCORE_WIN_MIN = SCORE_WIN - MAX_PLY;
+
+/// score bound which no search result can reach
+const int SCORE_INF = 32000;
+
+/// @brief		limits of a search (0 means no limit)
+struct SSearchLimits
+{
+	int nDepth;				///< maximum depth in plies
+	int nMoveTimeMs;		///< time budget in milliseconds
+	uint64_t nNodes;		///< node budget
+
+	SSearchLimits() : nDepth(0), nMoveTimeMs(0), nNodes(0) {}
+};
+
+/// @brief		result of a search
+struct SSearchResult
+{
+	Move bestMove;			///< best move (MOVE_NONE if there's no move)
+	int nScore;				///< score of the best move for the side to move
+	int nDepth;				///< depth of the last completed iteration
+	uint64_t nNodes;		///< the number of visited nodes
+	double dSeconds;		///< elapsed time
+	Move arrPv[MAX_PLY];	///< principal variation
+	int nPvLen;				///< length of the principal variation
+	STTStats ttStats;		///< transposition table statistics of this search
+};
+
+/// @brief		alpha-beta search with iterative deepening
+class CSearch
+{
+public:
+	explicit CSearch(CTransTable *pTT = 0, const CNnue *pNnue = 0)
+	: m_pTT(pTT), m_pNnue(pNnue), m_pOs(0), m_pSharedStop(0), m_nThreadIdx(0) {}
+
+	void SetShared(std::atomic<bool> *pSharedStop, const int nThreadIdx);
+
+	SSearchResult Go(const CPosition& pos, const SSearchLimits& limits, std::ostream *pOs = 0);
+
+private:
+	int Negamax(int depth, const int ply, int alpha, const int beta);
+	int Quiesce(const int ply, int alpha, const int beta);
+	void UpdateQuietStats(const int ply, const int depth, const Move m);
+	int Evaluate(const int ply) const;
+	bool IsTimeUp();
+	void ShowInfo(const int depth, const int score);
+
+private:
+	/// non construction-copyable
+	CSearch(const CSearch&);
+
+	/// non copyable
+	const CSearch& operator=(const CSearch&);
+
+private:
+	CPosition m_pos;							///< position being searched
+	CTransTable *m_pTT;							///< shared transposition table (0 for none)
+	const CNnue *m_pNnue;						///< network evaluation (0 for the hand-written one)
+	SNnueAccumulator m_arrAcc[MAX_PLY];			///< network accumulator of each ply (with m_pNnue)
+	STTStats m_ttStats;							///< table statistics of this search
+	SSearchLimits m_limits;						///< limits of the current search
+	std::ostream *m_pOs;						///< progress output (0 for none)
+	std::chrono::steady_clock::time_point m_tBegin;	///< start time of the search
+	uint64_t m_nNodes;							///< visited nodes
+	bool m_bStop;								///< set when a limit is reached
+	bool m_bCanStop;							///< false while the first iteration runs
+	std::atomic<bool> *m_pSharedStop;			///< stop request of a thread group (0 for none)
+	int m_nThreadIdx;							///< 0 for the main thread, >0 for helpers
+	Move m_arrPv[MAX_PLY][MAX_PLY];				///< triangular principal variation table
+	int m_arrPvLen[MAX_PLY];					///< length of each row of m_arrPv
+	Move m_arrPrevPv[MAX_PLY];					///< principal variation of the previous iteration
+	int m_nPrevPvLen;							///< length of m_arrPrevPv
+	Move m_arrKillers[MAX_PLY][KILLER_NB];		///< latest quiet moves which caused a cutoff at each ply
+	SHistory m_arrHistory[SIDE_NB];				///< quiet move cutoff statistics of each side
+};
+
+#endif // _SEARCH_H_
@@ -0,0 +1,89 @@
+///
+/// @file		See.cpp
+/// @author		Junpyo Hong (jp7.hong@gmail.com)
+/// @date		Oct. 18, 2026
+/// @version	1.0
+/// @brief		static exchange evaluation (the material outcome of captures on one square)
+/// @remark		Tab size: 4
+///
+
+#include <algorithm>	// std::max
+
+#include "See.h"
+#include "Eval.h"		// g_arrPieceValue
+
+namespace
+{
+	/// @brief		exchange value of a piece type (g_arrPieceValue, but the king is worth SEE_KING_VALUE)
+	inline int
+	SeeValue(const int type)
+	{
+		return (type == TYPE_KING) ? SEE_KING_VALUE : g_arrPieceValue[type];
+	}
+
+	/// order in which the pieces recapture: the least valuable first
+	const int s_arrRecaptureOrder[TYPE_NB] = { TYPE_PAWN, TYPE_BISH, TYPE_ROOK, TYPE_KING };
+}
+
+/// @brief		material won (or lost) by a capture and the best recaptures on its square
+/// @param		pos [in] position
+/// @param		m [in] a capture of the side to move
+/// @return		gain for the side to move (SEE_KING_VALUE or more if the king is captured)
+/// @remark		each side recaptures with its least valuable attacker, or stops when that
+///				would lose material. The attackers come from CPosition::GetAttackersTo() with
+///				the pieces that have already captured removed, so sliders behind them join in.
+///				No move is made: the sequence only looks at the one square.
+int
+See(const CPosition& pos, const Move m)
+{
+	int from = MoveFrom(m);
+	int to = MoveTo(m);
+	int side = pos.GetSide();
+	int attacker = pos.GetTypeAt(from);
+	int victim = pos.GetTypeAt(to);
+	Bitboard bbOccupied = pos.GetOccupied();
+	Bitboard bbFrom = SqBB(from);
+
+	// arrGain[d]: material of the side making capture d + 1 if the other side doesn't answer it
+	int arrGain[PIECE_MAX + 1];
+	int d = 0;
+	arrGain[0] = SeeValue(victim);
+
+	do
+	{
+		d++;
+
+		// a captured king ends the game, so nothing answers that capture
+		if (victim == TYPE_KING)
+			break;
+
+		arrGain[d] = SeeValue(attacker) - arrGain[d - 1];
+
+		// neither side can improve on stopping here
+		if (std::max(-arrGain[d - 1], arrGain[d]) < 0)
+			break;
+
+		bbOccupied ^= bbFrom;
+		side ^= 1;
+
+		// the least valuable piece of the side to recapture which still stands
+		Bitboard bbAttackers = pos.GetAttackersTo(to, bbOccupied) & bbOccupied & pos.GetSideBB(side);
+		bbFrom = 0;
+		for (int i = 0; i < TYPE_NB && !bbFrom; i++)
+		{
+			Bitboard bb = bbAttackers & pos.GetPieces(side, s_arrRecaptureOrder[i]);
+			if (bb)
+			{
+				bbFrom = SqBB(Lsb(bb));
+				victim = attacker;
+				attacker = s_arrRecaptureOrder[i];
+			}
+		}
+	} while (bbFrom);
+
+	// each side picks the better of capturing and standing pat, from the last capture back
+	while (--d)
+		arrGain[d - 1] = -std::max(-arrGain[d - 1], arrGain[d]);
+
+	return arrGain[0];
+}
@@ -0,0 +1,21 @@
+///
+/// @file		See.h
+/// @author		Junpyo Hong (jp7.hong@gmail.com)
+/// @date		Oct. 18, 2026
+/// @version	1.0
+/// @brief		static exchange evaluation (the material outcome of captures on one square)
+/// @remark		Tab size: 4
+///
+
+#ifndef _SEE_H_
+#define _SEE_H_
+
+#include "Position.h"
+#include "Move.h"
+
+/// exchange value of the king: more than all other material, as capturing it ends the game
+const int SEE_KING_VALUE = 10000;
+
+int See(const CPosition& pos, const Move m);
+
+#endif // _SEE_H_
@@ -0,0 +1,93 @@
+///
+/// @file		SmpSearch.cpp
+/// @author		Junpyo Hong (jp7.hong@gmail.com)
+/// @date		Oct. 18, 2026
+/// @version	1.0
+/// @brief		lazy SMP: several CSearch threads on one root with a shared table
+/// @remark		Tab size: 4
+///
+
+#include <thread>		// std::thread
+
+#include "SmpSearch.h"
+
+/// @brief		constructor
+/// @param		pTT [in] transposition table shared by every thread
+/// @param		nThreads [in] the number of threads (at least 1)
+/// @param		pNnue [in] network evaluation shared by every thread (0 for the hand-written one)
+/// @return		N/A
+CSmpSearch::CSmpSearch(CTransTable *pTT, const int nThreads, const CNnue *pNnue)
+: m_pTT(pTT)
+{
+	m_bStop.store(false);
+
+	for (int i = 0; i < (nThreads > 0 ? nThreads : 1); i++)
+	{
+		m_vSearch.push_back(new CSearch(pTT, pNnue));
+		m_vSearch.back()->SetShared(&m_bStop, i);
+	}
+}
+
+/// @brief		destructor
+/// @param		N/A
+/// @return		N/A
+CSmpSearch::~CSmpSearch()
+{
+	for (size_t i = 0; i < m_vSearch.size(); i++)
+		delete m_vSearch[i];
+}
+
+/// @brief		search with every thread until the main thread reaches a limit
+/// @param		pos [in] root position
+/// @param		limits [in] limits (applied by the main thread)
+/// @param		pOs [in] stream for the main thread's info lines (0 for none)
+/// @return		result of the deepest completed search (nodes and table statistics are summed)
+SSearchResult
+CSmpSearch::Go(const CPosition& pos, const SSearchLimits& limits, std::ostream *pOs)
+{
+	std::vector<SSearchResult> vResult(m_vSearch.size());
+	std::vector<std::thread> vThread;
+
+	m_bStop.store(false);
+
+	// one new age per search, before any thread probes or stores
+	if (m_pTT)
+		m_pTT->NewSearch();
+
+	// helpers search without limits until the main thread is done
+	SSearchLimits helperLimits;
+	helperLimits.nDepth = limits.nDepth;
+	for (size_t i = 1; i < m_vSearch.size(); i++)
+	{
+		vThread.push_back(std::thread([this, &pos, &helperLimits, &vResult, i]()
+		{
+			vResult[i] = m_vSearch[i]->Go(pos, helperLimits);
+		}));
+	}
+
+	vResult[0] = m_vSearch[0]->Go(pos, limits, pOs);
+
+	Stop();
+	for (size_t i = 0; i < vThread.size(); i++)
+		vThread[i].join();
+
+	// take the deepest completed iteration (the main thread wins ties)
+	size_t nBest = 0;
+	for (size_t i = 1; i < vResult.size(); i++)
+	{
+		if (vResult[i].nDepth > vResult[nBest].nDepth && vResult[i].bestMove != MOVE_NONE)
+			nBest = i;
+	}
+
+	SSearchResult result = vResult[nBest];
+	result.nNodes = 0;
+	result.ttStats = STTStats();
+	for (size_t i = 0; i < vResult.size(); i++)
+	{
+		result.nNodes += vResult[i].nNodes;
+		result.ttStats.Add(vResult[i].ttStats);
+	}
+	result.dSeconds = vResult[0].dSeconds;
+
+	return result;
+}
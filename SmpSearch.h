@@ -0,0 +1,43 @@
+///
+/// @file		SmpSearch.h
+/// @author		Junpyo Hong (jp7.hong@gmail.com)
+/// @date		Oct. 18, 2026
+/// @version	1.0
+/// @brief		lazy SMP: several CSearch threads on one root with a shared table
+/// @remark		Tab size: 4
+///
+
+#ifndef _SMP_SEARCH_H_
+#define _SMP_SEARCH_H_
+
+#include <vector>		// std::vector
+#include <atomic>		// std::atomic
+
+#include "Search.h"
+
+/// @brief		lazy SMP: several CSearch threads on one root with a shared table
+/// @remark		with one thread the search is the plain (deterministic) CSearch
+class CSmpSearch
+{
+public:
+	explicit CSmpSearch(CTransTable *pTT, const int nThreads, const CNnue *pNnue = 0);
+	~CSmpSearch();
+
+	SSearchResult Go(const CPosition& pos, const SSearchLimits& limits, std::ostream *pOs = 0);
+	void Stop() { m_bStop.store(true, std::memory_order_relaxed); }
+	int GetThreads() const { return int(m_vSearch.size()); }
+
+private:
+	/// non construction-copyable
+	CSmpSearch(const CSmpSearch&);
+
+	/// non copyable
+	const CSmpSearch& operator=(const CSmpSearch&);
+
+private:
+	CTransTable *m_pTT;						///< table shared by all threads (0 for none)
+	std::vector<CSearch*> m_vSearch;		///< one search per thread (index 0 is the main thread)
+	std::atomic<bool> m_bStop;				///< stop request shared by all threads
+};
+
+#endif // _SMP_SEARCH_H_
@@ -0,0 +1,311 @@
+///
+/// @file		TransTable.cpp
+/// @author		Junpyo Hong (jp7.hong@gmail.com)
+/// @date		Oct. 18, 2026
+/// @version	1.0
+/// @brief		lock-free transposition table shared by search threads
+/// @remark		Tab size: 4
+///
+
+#include <cstdlib>		// posix_memalign, free
+
+#if defined(_WIN32)
+#include <malloc.h>		// _aligned_malloc, _aligned_free
+#else
+#include <sys/mman.h>	// mmap, munmap, madvise
+#endif
+
+#include "TransTable.h"
+#include "Search.h"		// SCORE_WIN_MIN
+
+namespace
+{
+	/// huge page size assumed for MAP_HUGETLB (x86-64 default)
+	const size_t HUGE_PAGE_SIZE = size_t(2) << 20;
+
+	/// @brief		pack an entry into 64 bits (a stored entry never has BOUND_NONE)
+	inline uint64_t
+	PackData(const Move move, const int nScore, const int nDepth, const int nBound, const unsigned nAge)
+	{
+		return uint64_t(move) \
+			| (uint64_t(uint16_t(int16_t(nScore))) << 16) \
+			| (uint64_t(uint8_t(nDepth)) << 32) \
+			| (uint64_t(nBound & 3) << 40) \
+			| (uint64_t(nAge & 0x3F) << 42);
+	}
+
+	inline Move DataMove(const uint64_t d) { return Move(d & 0xFFFF); }
+	inline int DataScore(const uint64_t d) { return int(int16_t(uint16_t(d >> 16))); }
+	inline int DataDepth(const uint64_t d) { return int((d >> 32) & 0xFF); }
+	inline int DataBound(const uint64_t d) { return int((d >> 40) & 3); }
+	inline unsigned DataAge(const uint64_t d) { return unsigned((d >> 42) & 0x3F); }
+}
+
+/// @brief		constructor (the table is empty until Resize() is called)
+/// @param		N/A
+/// @return		N/A
+CTransTable::CTransTable()
+: m_pBuckets(0)
+, m_nBuckets(0)
+, m_nAllocBytes(0)
+, m_bHugePages(false)
+, m_bMapped(false)
+, m_nAge(0)
+{
+}
+
+/// @brief		destructor
+/// @param		N/A
+/// @return		N/A
+CTransTable::~CTransTable()
+{
+	Free();
+}
+
+/// @brief		allocate the table and clear it
+/// @param		nMB [in] size in megabytes (rounded down to a power of two number of buckets)
+/// @param		bHugePages [in] true to try huge page backing (Linux only)
+/// @return		true on success, otherwise false (the table is then empty)
+bool
+CTransTable::Resize(const size_t nMB, const bool bHugePages)
+{
+	Free();
+
+	size_t nBuckets = 1;
+	while (nBuckets * 2 * sizeof(SBucket) <= (nMB << 20))
+		nBuckets *= 2;
+
+	size_t nBytes = nBuckets * sizeof(SBucket);
+	void *p = 0;
+
+#if defined(_WIN32)
+	(void)bHugePages;
+	p = _aligned_malloc(nBytes, sizeof(SBucket));
+#else
+#if defined(MAP_HUGETLB)
+	// explicit huge pages need pre-reserved pages (vm.nr_hugepages), so this may fail
+	if (bHugePages && nBytes >= HUGE_PAGE_SIZE)
+	{
+		p = mmap(0, nBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+		if (p == MAP_FAILED)
+			p = 0;
+		else
+			m_bHugePages = m_bMapped = true;
+	}
+#endif
+	if (!p && bHugePages)
+	{
+		// fall back to transparent huge pages
+		p = mmap(0, nBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (p == MAP_FAILED)
+		{
+			p = 0;
+		}
+		else
+		{
+			m_bMapped = true;
+#if defined(MADV_HUGEPAGE)
+			m_bHugePages = (madvise(p, nBytes, MADV_HUGEPAGE) == 0);
+#endif
+		}
+	}
+	if (!p && posix_memalign(&p, sizeof(SBucket), nBytes) != 0)
+		p = 0;
+#endif
+
+	if (!p)
+		return false;
+
+	m_pBuckets = static_cast<SBucket*>(p);
+	m_nBuckets = nBuckets;
+	m_nAllocBytes = nBytes;
+	Clear();
+
+	return true;
+}
+
+/// @brief		release the table
+/// @param		N/A
+/// @return		void
+void
+CTransTable::Free()
+{
+	if (m_pBuckets)
+	{
+#if defined(_WIN32)
+		_aligned_free(m_pBuckets);
+#else
+		if (m_bMapped)
+			munmap(m_pBuckets, m_nAllocBytes);
+		else
+			free(m_pBuckets);
+#endif
+	}
+
+	m_pBuckets = 0;
+	m_nBuckets = 0;
+	m_nAllocBytes = 0;
+	m_bHugePages = false;
+	m_bMapped = false;
+}
+
+/// @brief		remove every entry
+/// @param		N/A
+/// @return		void
+/// @remark		must not be called while a search is running
+void
+CTransTable::Clear()
+{
+	for (size_t i = 0; i < m_nBuckets; i++)
+	{
+		for (int j = 0; j < TT_BUCKET_SIZE; j++)
+		{
+			m_pBuckets[i].arrEntry[j].nKeyXorData.store(0, std::memory_order_relaxed);
+			m_pBuckets[i].arrEntry[j].nData.store(0, std::memory_order_relaxed);
+		}
+	}
+
+	m_nAge = 0;
+}
+
+/// @brief		look up a position
+/// @param		nKey [in] Zobrist key
+/// @param		data [out] stored entry (valid only when true is returned)
+/// @param		stats [in,out] statistics of the calling thread
+/// @return		true if the position is found, otherwise false
+bool
+CTransTable::Probe(const uint64_t nKey, STTData& data, STTStats& stats) const
+{
+	stats.nProbes++;
+
+	if (!m_nBuckets)
+		return false;
+
+	const SBucket& bucket = m_pBuckets[nKey & (m_nBuckets - 1)];
+
+	for (int i = 0; i < TT_BUCKET_SIZE; i++)
+	{
+		uint64_t nData = bucket.arrEntry[i].nData.load(std::memory_order_relaxed);
+		uint64_t nKeyXorData = bucket.arrEntry[i].nKeyXorData.load(std::memory_order_relaxed);
+
+		// a torn entry (written by two threads at once) fails this check
+		if ((nKeyXorData ^ nData) == nKey && DataBound(nData) != BOUND_NONE)
+		{
+			data.move = DataMove(nData);
+			data.nScore = DataScore(nData);
+			data.nDepth = DataDepth(nData);
+			data.nBound = DataBound(nData);
+			stats.nHits++;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/// @brief		store a search result
+/// @param		nKey [in] Zobrist key
+/// @param		move [in] best move (MOVE_NONE keeps the move already stored for this key)
+/// @param		nScore [in] score converted by ScoreToTT()
+/// @param		nDepth [in] remaining depth
+/// @param		nBound [in] EBound
+/// @param		stats [in,out] statistics of the calling thread
+/// @return		void
+void
+CTransTable::Store(const uint64_t nKey, const Move move, const int nScore, \
+const int nDepth, const int nBound, STTStats& stats)
+{
+	stats.nStores++;
+
+	if (!m_nBuckets)
+		return;
+
+	SBucket& bucket = m_pBuckets[nKey & (m_nBuckets - 1)];
+	SEntry *pReplace = 0;
+	int nWorst = 0x7FFFFFFF;
+	Move moveKeep = move;
+
+	for (int i = 0; i < TT_BUCKET_SIZE; i++)
+	{
+		SEntry& e = bucket.arrEntry[i];
+		uint64_t nData = e.nData.load(std::memory_order_relaxed);
+		uint64_t nKeyXorData = e.nKeyXorData.load(std::memory_order_relaxed);
+
+		// same position: overwrite it, keeping the old move if there's no new one
+		if ((nKeyXorData ^ nData) == nKey && DataBound(nData) != BOUND_NONE)
+		{
+			if (moveKeep == MOVE_NONE)
+				moveKeep = DataMove(nData);
+			pReplace = &e;
+			break;
+		}
+
+		// otherwise replace the shallowest entry, preferring entries of old searches
+		int nValue = (DataBound(nData) == BOUND_NONE) ? -0x10000 : \
+			DataDepth(nData) - 8 * int((m_nAge - DataAge(nData)) & 0x3F);
+		if (nValue < nWorst)
+		{
+			nWorst = nValue;
+			pReplace = &e;
+		}
+	}
+
+	uint64_t nOld = pReplace->nData.load(std::memory_order_relaxed);
+	if (DataBound(nOld) != BOUND_NONE && DataAge(nOld) == m_nAge \
+		&& (pReplace->nKeyXorData.load(std::memory_order_relaxed) ^ nOld) != nKey)
+		stats.nCollisions++;
+
+	uint64_t nData = PackData(moveKeep, nScore, nDepth, nBound, m_nAge);
+	pReplace->nKeyXorData.store(nKey ^ nData, std::memory_order_relaxed);
+	pReplace->nData.store(nData, std::memory_order_relaxed);
+}
+
+/// @brief		used entries of the current search among the first 1000 buckets
+/// @param		N/A
+/// @return		fill rate in permille
+int
+CTransTable::GetFillPermille() const
+{
+	size_t nSample = (m_nBuckets < 1000) ? m_nBuckets : 1000;
+	size_t nUsed = 0;
+
+	for (size_t i = 0; i < nSample; i++)
+	{
+		for (int j = 0; j < TT_BUCKET_SIZE; j++)
+		{
+			uint64_t nData = m_pBuckets[i].arrEntry[j].nData.load(std::memory_order_relaxed);
+			if (DataBound(nData) != BOUND_NONE && DataAge(nData) == m_nAge)
+				nUsed++;
+		}
+	}
+
+	return nSample ? int(nUsed * 1000 / (nSample * TT_BUCKET_SIZE)) : 0;
+}
+
+/// @brief		make a king capture score relative to the node (the table is shared by all plies)
+/// @param		nScore [in] score relative to the root
+/// @param		ply [in] distance from the root
+/// @return		score to store
+int
+CTransTable::ScoreToTT(const int nScore, const int ply)
+{
+	if (nScore >= SCORE_WIN_MIN)
+		return nScore + ply;
+	if (nScore <= -SCORE_WIN_MIN)
+		return nScore - ply;
+	return nScore;
+}
+
+/// @brief		make a stored king capture score relative to the root again
+/// @param		nScore [in] stored score
+/// @param		ply [in] distance from the root
+/// @return		score relative to the root
+int
+CTransTable::ScoreFromTT(const int nScore, const int ply)
+{
+	if (nScore >= SCORE_WIN_MIN)
+		return nScore - ply;
+	if (nScore <= -SCORE_WIN_MIN)
+		return nScore + ply;
+	return nScore;
+}
@@ -0,0 +1,107 @@
+///
+/// @file		TransTable.h
+/// @author		Junpyo Hong (jp7.hong@gmail.com)
+/// @date		Oct. 18, 2026
+/// @version	1.0
+/// @brief		lock-free transposition table shared by search threads
+/// @remark		Tab size: 4
+///
+
+#ifndef _TRANS_TABLE_H_
+#define _TRANS_TABLE_H_
+
+#include <cstdint>		// uint64_t
+#include <cstddef>		// size_t
+#include <atomic>		// std::atomic
+
+#include "Move.h"
+
+/// bound type of a stored score
+enum EBound { BOUND_NONE = 0, BOUND_UPPER, BOUND_LOWER, BOUND_EXACT };
+
+/// the number of entries in a bucket (a bucket fills one 64-byte cache line)
+#define TT_BUCKET_SIZE	(4)
+
+/// @brief		unpacked content of a table entry
+struct STTData
+{
+	Move move;			///< best move (MOVE_NONE if unknown)
+	int nScore;			///< score (see CTransTable::ScoreToTT)
+	int nDepth;			///< remaining depth of the search which stored it
+	int nBound;			///< EBound
+};
+
+/// @brief		per-thread table statistics (merged by the caller, so there's no contention)
+struct STTStats
+{
+	uint64_t nProbes;		///< calls to Probe()
+	uint64_t nHits;			///< probes which found the position
+	uint64_t nStores;		///< calls to Store()
+	uint64_t nCollisions;	///< stores which evicted another position of the current search
+
+	STTStats() : nProbes(0), nHits(0), nStores(0), nCollisions(0) {}
+	void Add(const STTStats& s)
+	{
+		nProbes += s.nProbes;
+		nHits += s.nHits;
+		nStores += s.nStores;
+		nCollisions += s.nCollisions;
+	}
+};
+
+/// @brief		lock-free transposition table shared by search threads
+/// @remark		an entry stores (key ^ data, data); a torn write by another thread makes
+///				the key check fail instead of returning a mixed-up entry
+class CTransTable
+{
+public:
+	explicit CTransTable();
+	~CTransTable();
+
+	bool Resize(const size_t nMB, const bool bHugePages = false);
+	void Clear();
+	void NewSearch() { m_nAge = (m_nAge + 1) & 0x3F; }
+
+	bool Probe(const uint64_t nKey, STTData& data, STTStats& stats) const;
+	void Store(const uint64_t nKey, const Move move, const int nScore, \
+		const int nDepth, const int nBound, STTStats& stats);
+
+	size_t GetSizeMB() const { return m_nBuckets * sizeof(SBucket) >> 20; }
+	bool IsHugePages() const { return m_bHugePages; }
+	int GetFillPermille() const;
+
+	static int ScoreToTT(const int nScore, const int ply);
+	static int ScoreFromTT(const int nScore, const int ply);
+
+private:
+	/// non construction-copyable
+	CTransTable(const CTransTable&);
+
+	/// non copyable
+	const CTransTable& operator=(const CTransTable&);
+
+	void Free();
+
+private:
+	/// @brief		one entry (16 bytes)
+	struct SEntry
+	{
+		std::atomic<uint64_t> nKeyXorData;	///< Zobrist key ^ nData
+		std::atomic<uint64_t> nData;		///< move, score, depth, bound, and age packed
+	};
+
+	/// @brief		entries sharing one cache line
+	struct alignas(64) SBucket
+	{
+		SEntry arrEntry[TT_BUCKET_SIZE];
+	};
+
+	SBucket *m_pBuckets;		///< table (power-of-two number of buckets)
+	size_t m_nBuckets;			///< the number of buckets
+	size_t m_nAllocBytes;		///< allocated bytes (for Free())
+	bool m_bHugePages;			///< true if the table is backed by huge pages
+	bool m_bMapped;				///< true if the table was allocated by mmap()
+	unsigned m_nAge;			///< generation of the current search [0..63]
+};
+
+#endif // _TRANS_TABLE_H_
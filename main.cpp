@@ -7,7 +7,157 @@
 /// @remark		Tab size: 4
 ///
 
+#include <iostream>		// std::cout, std::cerr
+#include <cstring>		// strcmp
+#include <cstdlib>		// atoi, strtoull
+#include <vector>		// std::vector
+
 #include "ChessBoard.h"
+#include "Bench.h"
+#include "Perft.h"
+#include "SmpSearch.h"
+#include "Replay.h"
+#include "GameArchive.h"
+#include "Instrument.h"
+
+/// @brief		command line options (given anywhere as "--name [value]")
+struct SOptions
+{
+	size_t nHashMB;			///< transposition table size in megabytes (--hash MB)
+	bool bHugePages;		///< back the transposition table with huge pages (--huge-pages)
+	int nThreads;			///< the number of search threads (--threads N)
+	bool bLegal;			///< strictly legal moves for perft (--legal)
+	const char *szFen;		///< start position instead of the initial position (--fen "FEN")
+	const char *szNnue;		///< network file of the search evaluation (--nnue FILE)
+
+	SOptions() : nHashMB(16), bHugePages(false), nThreads(1), bLegal(false), szFen(0), szNnue(0) {}
+};
+
+/// @brief		print command line usage
+/// @param		N/A
+/// @return		void
+static void
+ShowUsage()
+{
+	std::cerr << "usage: Chess                  interactive game" << std::endl;
+	std::cerr << "       Chess perft <depth>    count leaf nodes from the initial position (or --fen)" << std::endl;
+	std::cerr << "       Chess divide <depth>   perft for each root move" << std::endl;
+	std::cerr << "       Chess perftsuite       check the reference perft counts" << std::endl;
+	std::cerr << "       Chess go [depth N] [movetime MS] [nodes N]" << std::endl;
+	std::cerr << "                              search the best move from the initial position (or --fen)" << std::endl;
+	std::cerr << "       Chess replay <file>    replay one game per line, one result per game (- for stdin)" << std::endl;
+	std::cerr << "       Chess archive <text> <archive>" << std::endl;
+	std::cerr << "                              convert replay lines to a binary game archive" << std::endl;
+	std::cerr << "       Chess bench            sliding attack micro-benchmark" << std::endl;
+	std::cerr << "       Chess smpbench [depth] time-to-depth from 1 to --threads threads" << std::endl;
+	std::cerr << "options: --hash MB            transposition table size (default 16)" << std::endl;
+	std::cerr << "         --huge-pages         back the transposition table with huge pages" << std::endl;
+	std::cerr << "         --threads N          the number of search threads (default 1)" << std::endl;
+	std::cerr << "         --legal              perft/divide with strictly legal moves" << std::endl;
+	std::cerr << "         --fen \"FEN\"           start the game, perft, or go from a position" << std::endl;
+	std::cerr << "         --nnue FILE          search with a network written by nnue_train" << std::endl;
+}
+
+/// @brief		remove options from the arguments
+/// @param		argc [in] the number of arguments
+/// @param		argv [in] arguments
+/// @param		opt [out] parsed options
+/// @param		vArgs [out] arguments which are not options (program name included)
+/// @return		true on success, false on an unknown or incomplete option
+static bool
+ParseOptions(int argc, char *argv[], SOptions& opt, std::vector<char*>& vArgs)
+{
+	for (int i = 0; i < argc; i++)
+	{
+		if (strncmp(argv[i], "--", 2) != 0)
+		{
+			vArgs.push_back(argv[i]);
+		}
+		else if (strcmp(argv[i], "--hash") == 0 && i + 1 < argc)
+		{
+			opt.nHashMB = size_t(strtoull(argv[++i], 0, 10));
+		}
+		else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+		{
+			opt.nThreads = atoi(argv[++i]);
+			if (opt.nThreads < 1)
+				return false;
+		}
+		else if (strcmp(argv[i], "--huge-pages") == 0)
+		{
+			opt.bHugePages = true;
+		}
+		else if (strcmp(argv[i], "--legal") == 0)
+		{
+			opt.bLegal = true;
+		}
+		else if (strcmp(argv[i], "--fen") == 0 && i + 1 < argc)
+		{
+			opt.szFen = argv[++i];
+		}
+		else if (strcmp(argv[i], "--nnue") == 0 && i + 1 < argc)
+		{
+			opt.szNnue = argv[++i];
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/// @brief		search the best move ("go depth N", "go movetime MS", "go nodes N")
+/// @param		pos [in] root position
+/// @param		opt [in] command line options
+/// @param		pNnue [in] network evaluation (0 for the hand-written one)
+/// @param		argc [in] the number of arguments after "go"
+/// @param		argv [in] arguments after "go"
+/// @return		0 on success, 1 on a bad argument
+static int
+Go(const CPosition& pos, const SOptions& opt, const CNnue *pNnue, int argc, char *argv[])
+{
+	SSearchLimits limits;
+
+	for (int i = 0; i + 1 < argc; i += 2)
+	{
+		if (strcmp(argv[i], "depth") == 0)
+			limits.nDepth = atoi(argv[i + 1]);
+		else if (strcmp(argv[i], "movetime") == 0)
+			limits.nMoveTimeMs = atoi(argv[i + 1]);
+		else if (strcmp(argv[i], "nodes") == 0)
+			limits.nNodes = strtoull(argv[i + 1], 0, 10);
+		else
+			return 1;
+	}
+
+	if (argc % 2 != 0)
+		return 1;
+
+	CTransTable tt;
+	if (opt.nHashMB > 0 && !tt.Resize(opt.nHashMB, opt.bHugePages))
+		std::cerr << "cannot allocate " << opt.nHashMB << " MB for the hash table" << std::endl;
+
+	CSmpSearch search(&tt, opt.nThreads, pNnue);
+	SSearchResult result = search.Go(pos, limits, &std::cout);
+
+	char szMove[6];
+	std::cout << "bestmove " << \
+		(result.bestMove != MOVE_NONE ? FormatMove(result.bestMove, szMove) : "none") << std::endl;
+
+	std::cout << "threads " << opt.nThreads << " nodes " << result.nNodes \
+		<< " nps " << uint64_t(result.nNodes / (result.dSeconds > 0 ? result.dSeconds : 1e-9)) << std::endl;
+
+	const STTStats& st = result.ttStats;
+	std::cout << "hash " << tt.GetSizeMB() << " MB" << (tt.IsHugePages() ? " (huge pages)" : "") \
+		<< " probes " << st.nProbes << " hits " << st.nHits \
+		<< " (" << (st.nProbes ? st.nHits * 100 / st.nProbes : 0) << "%)" \
+		<< " stores " << st.nStores << " collisions " << st.nCollisions \
+		<< " fill " << tt.GetFillPermille() << " permille" << std::endl;
+
+	return 0;
+}
 
 /// @brief		entry point function of the program
 /// @param		argc [in] the number of arguments being passed into this program
@@ -15,7 +165,87 @@
 /// @return		0 on success
 int main(int argc, char *argv[])
 {
-	CChessBoard::GetInstance()->Run();
+	InstallInstrumentReport();
 
-	return 0;
+	SOptions opt;
+	std::vector<char*> vArgs;
+	if (!ParseOptions(argc, argv, opt, vArgs))
+	{
+		ShowUsage();
+		return 1;
+	}
+
+	argc = int(vArgs.size());
+	argv = &vArgs[0];
+
+	CPosition pos;
+	pos.SetStartPos();
+	if (opt.szFen && !pos.SetFen(opt.szFen))
+	{
+		std::cerr << "bad position: " << opt.szFen << std::endl;
+		return 1;
+	}
+
+	CNnue nnue;
+	if (opt.szNnue && !nnue.Load(opt.szNnue))
+	{
+		std::cerr << "bad network file: " << opt.szNnue << std::endl;
+		return 1;
+	}
+
+	if (argc == 1)
+	{
+		CChessBoard board;
+		if (opt.szFen)
+			board.SetPosition(pos);
+		board.Run();
+		return 0;
+	}
+
+	if ((strcmp(argv[1], "perft") == 0 || strcmp(argv[1], "divide") == 0) && argc > 2)
+	{
+		int nDepth = atoi(argv[2]);
+		if (nDepth < 1)
+		{
+			ShowUsage();
+			return 1;
+		}
+
+		RunPerft(pos, nDepth, std::cout, strcmp(argv[1], "divide") == 0, opt.bLegal);
+		return 0;
+	}
+
+	if (strcmp(argv[1], "perftsuite") == 0)
+		return RunPerftSuite(std::cout) ? 0 : 1;
+
+	if (strcmp(argv[1], "go") == 0)
+	{
+		if (Go(pos, opt, opt.szNnue ? &nnue : 0, argc - 2, argv + 2) != 0)
+		{
+			ShowUsage();
+			return 1;
+		}
+		return 0;
+	}
+
+	if (strcmp(argv[1], "replay") == 0 && argc > 2)
+		return RunReplay(argv[2], std::cout, opt.nThreads) ? 0 : 1;
+
+	if (strcmp(argv[1], "archive") == 0 && argc > 3)
+		return ConvertGameText(argv[2], argv[3]) ? 0 : 1;
+
+	if (strcmp(argv[1], "bench") == 0)
+	{
+		BenchSliders();
+		return 0;
+	}
+
+	if (strcmp(argv[1], "smpbench") == 0)
+	{
+		BenchSmp(opt.nThreads, (argc > 2) ? atoi(argv[2]) : 9, opt.nHashMB);
+		return 0;
+	}
+
+	ShowUsage();
+	return 1;
 }